@@ -0,0 +1,1215 @@
+#define _GNU_SOURCE
+
+#include "int512.h"
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* ============================================================================
+ * Benchmark Harness
+ * ============================================================================ */
+
+#define BENCH_VALUES 256
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t rng_next(void) {
+    /* xorshift64* */
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return rng_state * 0x2545f4914f6cdd1dULL;
+}
+
+/* Random value with exactly `limbs` significant limbs */
+static void rng_fill(uint512_t *v, int limbs) {
+    *v = UINT512_ZERO;
+    for (int i = 0; i < limbs; i++) v->words[i] = rng_next();
+    if (limbs > 0 && v->words[limbs - 1] == 0) v->words[limbs - 1] = 1;
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static volatile uint64_t sink;
+
+/*
+ * Retired user-space instruction counter.  Returns -1 where it is not
+ * available (non-Linux, perf_event_paranoid > 2, or no PMU in a VM).
+ */
+static int instructions_open(void) {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+static uint64_t instructions_read(int fd) {
+    uint64_t count = 0;
+#ifdef __linux__
+    if (fd < 0 || read(fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) return 0;
+#else
+    (void)fd;
+#endif
+    return count;
+}
+
+/* ============================================================================
+ * Addition and Subtraction
+ * ============================================================================ */
+
+/* The original compare-and-branch carry loop, kept as a baseline */
+static void naive_add(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    uint64_t carry = 0;
+    for (int i = 0; i < 8; i++) {
+        uint64_t sum = a->words[i] + carry;
+        carry = (sum < carry) ? 1 : 0;
+        sum += b->words[i];
+        carry += (sum < b->words[i]) ? 1 : 0;
+        result->words[i] = sum;
+    }
+}
+
+static void bench_add(void) {
+    static uint512_t a[BENCH_VALUES];
+    static uint512_t b[BENCH_VALUES];
+    uint512_t r;
+    int512_t s;
+    int iters = 4000000;
+    int counter = instructions_open();
+
+    for (int i = 0; i < BENCH_VALUES; i++) {
+        rng_fill(&a[i], 8);
+        rng_fill(&b[i], 8);
+    }
+
+    printf("Addition and subtraction (8-limb operands)\n");
+    printf("  %-22s %8s %14s\n", "", "ns", "instructions");
+
+    for (int kind = 0; kind < 4; kind++) {
+        static const char *const names[] = {"compare-and-branch", "uint512_add", "uint512_sub", "int512_add"};
+        uint64_t before = instructions_read(counter);
+        double start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            const uint512_t *x = &a[it % BENCH_VALUES];
+            const uint512_t *y = &b[it % BENCH_VALUES];
+            switch (kind) {
+            case 0: naive_add(x, y, &r); break;
+            case 1: uint512_add(x, y, &r); break;
+            case 2: uint512_sub(x, y, &r); break;
+            default: int512_add((const int512_t *)x, (const int512_t *)y, &s); r.words[0] = s.words[0]; break;
+            }
+            sink += r.words[0];
+        }
+        double ns = (now_ns() - start) / iters;
+        uint64_t instructions = instructions_read(counter) - before;
+
+        if (counter >= 0) {
+            printf("  %-22s %8.1f %14.1f\n", names[kind], ns, (double)instructions / iters);
+        } else {
+            printf("  %-22s %8.1f %14s\n", names[kind], ns, "n/a");
+        }
+    }
+    if (counter >= 0) close(counter);
+    printf("\n");
+}
+
+/* ============================================================================
+ * Multiplication
+ * ============================================================================ */
+
+/* The original operand-scanning multiply, kept as a baseline */
+static void naive_mul(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    uint512_t temp = UINT512_ZERO;
+    for (int i = 0; i < 8; i++) {
+        if (b->words[i] == 0) continue;
+        uint64_t carry = 0;
+        for (int j = 0; j < 8; j++) {
+            if (i + j >= 8) continue;
+            __uint128_t prod = (__uint128_t)a->words[j] * b->words[i] + temp.words[i + j] + carry;
+            temp.words[i + j] = (uint64_t)prod;
+            carry = (uint64_t)(prod >> 64);
+        }
+    }
+    *result = temp;
+}
+
+static void bench_mul(void) {
+    static uint512_t a[BENCH_VALUES];
+    static uint512_t b[BENCH_VALUES];
+    uint512_t r;
+    uint1024_t wide;
+    int iters = 4000000;
+
+    for (int i = 0; i < BENCH_VALUES; i++) {
+        rng_fill(&a[i], 4);
+        rng_fill(&b[i], 4);
+    }
+
+    printf("Multiplication (4-limb operands)\n");
+
+    double start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        naive_mul(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+        sink += r.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "schoolbook", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_mul(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+        sink += r.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_mul", (now_ns() - start) / iters);
+
+    for (int i = 0; i < BENCH_VALUES; i++) {
+        rng_fill(&a[i], 8);
+        rng_fill(&b[i], 8);
+    }
+
+    static const int512_kernel_t kernels[] = {INT512_KERNEL_PORTABLE, INT512_KERNEL_MULX};
+    static const char *const names[] = {"portable", "mulx"};
+
+    printf("  %-22s %12s %12s\n", "8-limb kernel", "mul_wide ns", "sqr_wide ns");
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        if (int512_set_kernel(kernels[k]) != INT512_OK) continue;
+
+        start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_mul_wide(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &wide);
+            sink += wide.words[15];
+        }
+        double mul = (now_ns() - start) / iters;
+
+        start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_sqr_wide(&a[it % BENCH_VALUES], &wide);
+            sink += wide.words[15];
+        }
+        double sqr = (now_ns() - start) / iters;
+
+        printf("  %-22s %12.1f %12.1f\n", names[k], mul, sqr);
+    }
+    int512_set_kernel(INT512_KERNEL_AUTO);
+    printf("\n");
+}
+
+/* ============================================================================
+ * Division
+ * ============================================================================ */
+
+/* The original shift-and-subtract divider, kept as a baseline */
+static void bench_mixed(void) {
+    static uint512_t values[BENCH_VALUES];
+    static const char *const names[] = {
+        "uint512_add (u8 widened)", "uint512_add_u8",
+        "uint512_mul (u64 widened)", "uint512_mul_u64",
+        "uint512_mul (u128 widened)", "uint512_mul_u128",
+        "int512_add (i64 widened)", "int512_add_i64",
+    };
+    uint64_t b128[2] = {0x9e3779b97f4a7c15ULL, 0x2545f4914f6cdd1dULL};
+    uint512_t wide8 = {{200, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t wide64 = {{b128[0], 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t wide128 = {{b128[0], b128[1], 0, 0, 0, 0, 0, 0}};
+    int512_t wide_i64 = {{(uint64_t)-12345, UINT64_MAX, UINT64_MAX, UINT64_MAX,
+                          UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
+    uint512_t r;
+    int512_t s;
+    int iters = 2000000;
+
+    /* Six limbs so that the 128-bit products never overflow */
+    for (int i = 0; i < BENCH_VALUES; i++) rng_fill(&values[i], 6);
+
+    printf("Mixed-size operands (6-limb value)\n");
+
+    for (int kind = 0; kind < 8; kind++) {
+        double start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            const uint512_t *x = &values[it % BENCH_VALUES];
+            switch (kind) {
+            case 0: uint512_add(x, &wide8, &r); break;
+            case 1: uint512_add_u8(x, 200, &r); break;
+            case 2: uint512_mul(x, &wide64, &r); break;
+            case 3: uint512_mul_u64(x, b128[0], &r); break;
+            case 4: uint512_mul(x, &wide128, &r); break;
+            case 5: uint512_mul_u128(x, b128, &r); break;
+            case 6: int512_add((const int512_t *)x, &wide_i64, &s); r.words[0] = s.words[0]; break;
+            default: int512_add_i64((const int512_t *)x, -12345, &s); r.words[0] = s.words[0]; break;
+            }
+            sink += r.words[0];
+        }
+        printf("  %-26s %8.1f ns\n", names[kind], (now_ns() - start) / iters);
+    }
+    printf("\n");
+}
+
+#define WIDE_VALUES 16
+
+/* Best of several runs of uint4096_mul on n-limb operands */
+static double time_wide_mul(const uint4096_t *a, const uint4096_t *b, int iters) {
+    uint4096_t r;
+    double best = 0;
+    for (int rep = 0; rep < 5; rep++) {
+        double start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint4096_mul(&a[it % WIDE_VALUES], &b[it % WIDE_VALUES], &r);
+            sink += r.words[0];
+        }
+        double ns = (now_ns() - start) / iters;
+        if (rep == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+static void bench_karatsuba(void) {
+    static uint4096_t a[WIDE_VALUES], b[WIDE_VALUES];
+    static const int sizes[] = {16, 32, 48, 64};
+    int saved = int512_get_karatsuba_threshold();
+    int crossover = 0;
+
+    printf("Karatsuba crossover (uint4096_mul, n-limb operands, one split)\n");
+    printf("  %-8s %12s %12s\n", "limbs", "schoolbook", "karatsuba");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        int n = sizes[s];
+        int iters = 2000000 / (n * n);
+        for (int i = 0; i < WIDE_VALUES; i++) {
+            memset(&a[i], 0, sizeof(a[i]));
+            memset(&b[i], 0, sizeof(b[i]));
+            for (int j = 0; j < n; j++) {
+                a[i].words[j] = rng_next();
+                b[i].words[j] = rng_next();
+            }
+        }
+
+        int512_set_karatsuba_threshold(INT_MAX);
+        double school = time_wide_mul(a, b, iters);
+        int512_set_karatsuba_threshold(n);
+        double split = time_wide_mul(a, b, iters);
+
+        printf("  %-8d %9.1f ns %9.1f ns\n", n, school, split);
+        if (split < school && crossover == 0) crossover = n;
+        if (split >= school) crossover = 0;
+    }
+    int512_set_karatsuba_threshold(saved);
+
+    if (crossover) {
+        printf("  crossover: %d limbs (default threshold %d)\n", crossover, saved);
+    } else {
+        printf("  crossover: above %d limbs (default threshold %d)\n", sizes[3], saved);
+    }
+    printf("\n");
+}
+
+static void naive_div(const uint512_t *a, const uint512_t *b, uint512_t *quotient, uint512_t *remainder) {
+    *quotient = UINT512_ZERO;
+    uint512_t current = UINT512_ZERO;
+    for (int i = 511; i >= 0; i--) {
+        uint64_t carry = 0;
+        for (int j = 0; j < 8; j++) {
+            uint64_t new_carry = current.words[j] >> 63;
+            current.words[j] = (current.words[j] << 1) | carry;
+            carry = new_carry;
+        }
+        if (a->words[i / 64] & ((uint64_t)1 << (i % 64))) current.words[0] |= 1;
+        if (uint512_compare(&current, b) >= 0) {
+            uint512_sub(&current, b, &current);
+            quotient->words[i / 64] |= (uint64_t)1 << (i % 64);
+        }
+    }
+    *remainder = current;
+}
+
+static void bench_div(void) {
+    static uint512_t dividends[BENCH_VALUES];
+    static uint512_t divisors[BENCH_VALUES];
+    uint512_t q, r;
+
+    printf("uint512_div (8-limb dividend)\n");
+    printf("  %-14s %12s %12s %9s\n", "divisor limbs", "naive ns", "knuth ns", "speedup");
+
+    for (int limbs = 1; limbs <= 8; limbs++) {
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            rng_fill(&dividends[i], 8);
+            rng_fill(&divisors[i], limbs);
+        }
+
+        int naive_iters = 20000;
+        double start = now_ns();
+        for (int it = 0; it < naive_iters; it++) {
+            int i = it % BENCH_VALUES;
+            naive_div(&dividends[i], &divisors[i], &q, &r);
+            sink += q.words[0] ^ r.words[0];
+        }
+        double naive = (now_ns() - start) / naive_iters;
+
+        int fast_iters = 2000000;
+        start = now_ns();
+        for (int it = 0; it < fast_iters; it++) {
+            int i = it % BENCH_VALUES;
+            uint512_div(&dividends[i], &divisors[i], &q, &r);
+            sink += q.words[0] ^ r.words[0];
+        }
+        double fast = (now_ns() - start) / fast_iters;
+
+        printf("  %-14d %12.1f %12.1f %8.1fx\n", limbs, naive, fast, naive / fast);
+    }
+    printf("\n");
+}
+
+static void bench_div_u64(void) {
+    static uint512_t dividends[BENCH_VALUES];
+    uint512_t divisor_wide = {{10000000000000000000ULL, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_divisor_u64_t divisor;
+    uint512_t q, r;
+    uint64_t rem;
+    int iters = 2000000;
+
+    for (int i = 0; i < BENCH_VALUES; i++) rng_fill(&dividends[i], 8);
+    uint512_divisor_u64_init(&divisor, divisor_wide.words[0]);
+
+    printf("Division by one limb (8-limb dividend)\n");
+
+    double start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_div(&dividends[it % BENCH_VALUES], &divisor_wide, &q, &r);
+        sink += r.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_div", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_div_u64(&dividends[it % BENCH_VALUES], divisor_wide.words[0], &q, &rem);
+        sink += rem;
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_div_u64", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_div_u64_by(&dividends[it % BENCH_VALUES], &divisor, &q, &rem);
+        sink += rem;
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_div_u64_by", (now_ns() - start) / iters);
+    printf("\n");
+}
+
+static void bench_div_by(void) {
+    static uint512_t dividends[BENCH_VALUES];
+    uint512_t d, q, r;
+    uint512_divisor_t divisor;
+    int iters = 2000000;
+
+    for (int i = 0; i < BENCH_VALUES; i++) rng_fill(&dividends[i], 8);
+    rng_fill(&d, 4);
+    uint512_divisor_init(&divisor, &d);
+
+    printf("Division by a fixed 4-limb divisor (8-limb dividend)\n");
+
+    double start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_div(&dividends[it % BENCH_VALUES], &d, &q, &r);
+        sink += r.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_div", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_div_by(&dividends[it % BENCH_VALUES], &divisor, &q, &r);
+        sink += r.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_div_by", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_mod_by(&dividends[it % BENCH_VALUES], &divisor, &r);
+        sink += r.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_mod_by", (now_ns() - start) / iters);
+    printf("\n");
+}
+
+/* ============================================================================
+ * String Conversion
+ * ============================================================================ */
+
+/* The original digit-at-a-time converter, kept as a baseline */
+static void bench_mont(void) {
+    static uint512_t a[BENCH_VALUES], b[BENCH_VALUES];
+    uint512_t modulus, q, r;
+    uint512_mont_ctx_t ctx;
+    int iters = 2000000;
+
+    printf("Modular multiplication (odd modulus)\n");
+
+    for (int limbs = 4; limbs <= 8; limbs += 4) {
+        rng_fill(&modulus, limbs);
+        modulus.words[0] |= 1;
+        uint512_mont_init(&ctx, &modulus);
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            rng_fill(&a[i], limbs);
+            rng_fill(&b[i], limbs);
+            uint512_div(&a[i], &modulus, &q, &a[i]);
+            uint512_div(&b[i], &modulus, &q, &b[i]);
+        }
+
+        char label[32];
+        if (limbs == 4) {
+            /* A 256-bit product still fits in 512 bits */
+            double start = now_ns();
+            for (int it = 0; it < iters; it++) {
+                uint512_mul(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+                uint512_div(&r, &modulus, &q, &r);
+                sink += r.words[0];
+            }
+            printf("  %-26s %8.1f ns\n", "mul + div (4 limbs)", (now_ns() - start) / iters);
+        }
+
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            uint512_to_mont(&ctx, &a[i], &a[i]);
+            uint512_to_mont(&ctx, &b[i], &b[i]);
+        }
+
+        double start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_mont_mul(&ctx, &a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+            sink += r.words[0];
+        }
+        snprintf(label, sizeof(label), "mont_mul (%d limbs)", limbs);
+        printf("  %-26s %8.1f ns\n", label, (now_ns() - start) / iters);
+
+        start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_mont_sqr(&ctx, &a[it % BENCH_VALUES], &r);
+            sink += r.words[0];
+        }
+        snprintf(label, sizeof(label), "mont_sqr (%d limbs)", limbs);
+        printf("  %-26s %8.1f ns\n", label, (now_ns() - start) / iters);
+    }
+    printf("\n");
+}
+
+static void bench_barrett(void) {
+    static uint512_t a[BENCH_VALUES], b[BENCH_VALUES];
+    uint512_t modulus, q, r;
+    uint512_barrett_ctx_t ctx;
+    uint512_divisor_t divisor;
+    int iters = 2000000;
+
+    printf("Modular multiplication (even modulus)\n");
+
+    for (int limbs = 4; limbs <= 8; limbs += 4) {
+        rng_fill(&modulus, limbs);
+        modulus.words[0] &= ~(uint64_t)1;
+        uint512_barrett_init(&ctx, &modulus);
+        uint512_divisor_init(&divisor, &modulus);
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            rng_fill(&a[i], 8);
+            rng_fill(&b[i], limbs);
+            uint512_div(&b[i], &modulus, &q, &b[i]);
+        }
+
+        char label[32];
+        double start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_mod_by(&a[it % BENCH_VALUES], &divisor, &r);
+            sink += r.words[0];
+        }
+        snprintf(label, sizeof(label), "mod_by (%d limbs)", limbs);
+        printf("  %-26s %8.1f ns\n", label, (now_ns() - start) / iters);
+
+        start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_barrett_mod(&ctx, &a[it % BENCH_VALUES], &r);
+            sink += r.words[0];
+        }
+        snprintf(label, sizeof(label), "barrett_mod (%d limbs)", limbs);
+        printf("  %-26s %8.1f ns\n", label, (now_ns() - start) / iters);
+
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            uint512_div(&a[i], &modulus, &q, &a[i]);
+        }
+
+        if (limbs == 4) {
+            start = now_ns();
+            for (int it = 0; it < iters; it++) {
+                uint512_mul(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+                uint512_div(&r, &modulus, &q, &r);
+                sink += r.words[0];
+            }
+            printf("  %-26s %8.1f ns\n", "mul + div (4 limbs)", (now_ns() - start) / iters);
+        }
+
+        start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_barrett_mulmod(&ctx, &a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+            sink += r.words[0];
+        }
+        snprintf(label, sizeof(label), "barrett_mulmod (%d limbs)", limbs);
+        printf("  %-26s %8.1f ns\n", label, (now_ns() - start) / iters);
+    }
+    printf("\n");
+}
+
+/* Square-and-multiply with a division after every product */
+static void naive_powmod(const uint512_t *base, const uint512_t *exponent, const uint512_t *modulus,
+                         uint512_t *result) {
+    uint512_t q, acc = UINT512_ONE, g;
+    uint512_div(base, modulus, &q, &g);
+    for (int i = 511; i >= 0; i--) {
+        uint512_mul(&acc, &acc, &acc);
+        uint512_div(&acc, modulus, &q, &acc);
+        if ((exponent->words[i / 64] >> (i % 64)) & 1) {
+            uint512_mul(&acc, &g, &acc);
+            uint512_div(&acc, modulus, &q, &acc);
+        }
+    }
+    *result = acc;
+}
+
+static void bench_powmod(void) {
+    uint512_t base, exponent, modulus, r;
+    int iters = 200;
+
+    printf("Modular exponentiation (full-length exponent)\n");
+
+    for (int limbs = 4; limbs <= 8; limbs += 4) {
+        rng_fill(&modulus, limbs);
+        modulus.words[0] |= 1;
+        rng_fill(&base, limbs);
+        rng_fill(&exponent, limbs);
+        char label[32];
+
+        if (limbs == 4) {
+            /* Products of 256-bit residues still fit in 512 bits */
+            double start = now_ns();
+            for (int it = 0; it < iters; it++) {
+                naive_powmod(&base, &exponent, &modulus, &r);
+                sink += r.words[0];
+            }
+            printf("  %-26s %8.1f us\n", "mul + div loop (4 limbs)", (now_ns() - start) / iters / 1000);
+        }
+
+        double start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_powmod(&base, &exponent, &modulus, &r);
+            sink += r.words[0];
+        }
+        snprintf(label, sizeof(label), "powmod (%d limbs)", limbs);
+        printf("  %-26s %8.1f us\n", label, (now_ns() - start) / iters / 1000);
+
+        start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            uint512_powmod_ct(&base, &exponent, &modulus, &r);
+            sink += r.words[0];
+        }
+        snprintf(label, sizeof(label), "powmod_ct (%d limbs)", limbs);
+        printf("  %-26s %8.1f us\n", label, (now_ns() - start) / iters / 1000);
+    }
+    printf("\n");
+}
+
+/* Euclid with a full division per step */
+static void naive_gcd(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    uint512_t u = *a, v = *b, q, r;
+    while (!uint512_is_zero(&v)) {
+        uint512_div(&u, &v, &q, &r);
+        u = v;
+        v = r;
+    }
+    *result = u;
+}
+
+static void bench_gcd(void) {
+    static uint512_t a[BENCH_VALUES], b[BENCH_VALUES];
+    uint512_t r;
+    int512_t x, y;
+    int iters = 20000;
+
+    for (int i = 0; i < BENCH_VALUES; i++) {
+        rng_fill(&a[i], 8);
+        rng_fill(&b[i], 8);
+        b[i].words[0] |= 1;
+    }
+
+    printf("GCD and inverse (512-bit operands)\n");
+
+    double start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        naive_gcd(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+        sink += r.words[0];
+    }
+    printf("  %-26s %8.2f us\n", "div loop", (now_ns() - start) / iters / 1000);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_gcd(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+        sink += r.words[0];
+    }
+    printf("  %-26s %8.2f us\n", "gcd", (now_ns() - start) / iters / 1000);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_xgcd(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r, &x, &y);
+        sink += r.words[0] + x.words[0];
+    }
+    printf("  %-26s %8.2f us\n", "xgcd", (now_ns() - start) / iters / 1000);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_modinv(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+        sink += r.words[0];
+    }
+    printf("  %-26s %8.2f us\n", "modinv", (now_ns() - start) / iters / 1000);
+
+    iters /= 10;
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_modinv_ct(&a[it % BENCH_VALUES], &b[it % BENCH_VALUES], &r);
+        sink += r.words[0];
+    }
+    printf("  %-26s %8.2f us\n", "modinv_ct", (now_ns() - start) / iters / 1000);
+    printf("\n");
+}
+
+/* Newton's iteration from 2^ceil(bits / 2) with a full division per step */
+static void naive_isqrt(const uint512_t *a, uint512_t *result) {
+    int bits = 512;
+    while (bits > 0 && !uint512_test_bit(a, (unsigned int)bits - 1)) bits--;
+
+    uint512_t x = UINT512_ZERO, y, q, r;
+    uint512_set_bit(&x, (unsigned int)(bits + 1) / 2);
+    for (;;) {
+        uint512_div(a, &x, &q, &r);
+        uint512_add(&x, &q, &y);
+        uint512_shr(&y, 1, &y);
+        if (uint512_compare(&y, &x) >= 0) break;
+        x = y;
+    }
+    *result = x;
+}
+
+static void bench_roots(void) {
+    static uint512_t a[BENCH_VALUES];
+    uint512_t r, rem;
+    int iters = 200000;
+
+    for (int i = 0; i < BENCH_VALUES; i++) {
+        rng_fill(&a[i], 8);
+    }
+
+    printf("Integer roots (512-bit operands)\n");
+
+    double start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        naive_isqrt(&a[it % BENCH_VALUES], &r);
+        sink += r.words[0];
+    }
+    printf("  %-26s %8.1f ns\n", "Newton from a power of 2", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_isqrt(&a[it % BENCH_VALUES], &r, &rem);
+        sink += r.words[0] + rem.words[0];
+    }
+    printf("  %-26s %8.1f ns\n", "isqrt", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_iroot(&a[it % BENCH_VALUES], 3, &r);
+        sink += r.words[0];
+    }
+    printf("  %-26s %8.1f ns\n", "iroot (k = 3)", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        sink += uint512_is_perfect_square(&a[it % BENCH_VALUES]);
+    }
+    printf("  %-26s %8.1f ns\n", "is_perfect_square", (now_ns() - start) / iters);
+    printf("\n");
+}
+
+static void bench_prime(void) {
+    static uint512_t candidates[BENCH_VALUES];
+    uint512_t prime[2], r;
+    int iters = 2000;
+
+    printf("Primality (Baillie-PSW)\n");
+    for (int k = 0; k < 2; k++) {
+        int limbs = k ? 8 : 4;
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            rng_fill(&candidates[i], limbs);
+            candidates[i].words[0] |= 1;
+        }
+
+        double start = now_ns();
+        for (int it = 0; it < iters; it++) {
+            sink += uint512_is_probable_prime(&candidates[it % BENCH_VALUES]);
+        }
+        printf("  %-26s %8.2f us\n", k ? "odd candidate (512-bit)" : "odd candidate (256-bit)",
+               (now_ns() - start) / iters / 1000);
+
+        prime[k] = candidates[0];
+        while (!uint512_is_probable_prime(&prime[k])) {
+            uint512_add_u8(&prime[k], 2, &prime[k]);
+        }
+        start = now_ns();
+        for (int it = 0; it < iters / 10; it++) {
+            sink += uint512_is_probable_prime(&prime[k]);
+        }
+        printf("  %-26s %8.2f us\n", k ? "prime (512-bit)" : "prime (256-bit)",
+               (now_ns() - start) / (iters / 10) / 1000);
+    }
+
+    /* A Fermat test alone, for scale */
+    uint512_t two = {{2, 0, 0, 0, 0, 0, 0, 0}}, e;
+    uint512_sub(&prime[1], &UINT512_ONE, &e);
+    double start = now_ns();
+    for (int it = 0; it < iters / 10; it++) {
+        uint512_powmod(&two, &e, &prime[1], &r);
+        sink += r.words[0];
+    }
+    printf("  %-26s %8.2f us\n", "powmod 2^(n-1) (512-bit)", (now_ns() - start) / (iters / 10) / 1000);
+    printf("\n");
+}
+
+static void naive_to_string(const uint512_t *value, char *buffer, int base) {
+    char temp[600];
+    int pos = 0;
+    uint512_t num = *value;
+    uint512_t base_val = {{(uint64_t)base, 0, 0, 0, 0, 0, 0, 0}};
+    do {
+        uint512_t quotient, remainder;
+        uint512_div(&num, &base_val, &quotient, &remainder);
+        int digit = (int)remainder.words[0];
+        temp[pos++] = (char)((digit < 10) ? ('0' + digit) : ('a' + digit - 10));
+        num = quotient;
+    } while (!uint512_is_zero(&num));
+    for (int i = 0; i < pos; i++) buffer[i] = temp[pos - 1 - i];
+    buffer[pos] = '\0';
+}
+
+static void bench_to_string(void) {
+    static uint512_t values[BENCH_VALUES];
+    static const int bases[] = {10, 16, 2, 36};
+    char buffer[600];
+
+    for (int i = 0; i < BENCH_VALUES; i++) rng_fill(&values[i], 8);
+
+    printf("uint512_to_string (8-limb value)\n");
+    printf("  %-6s %12s %12s %9s\n", "base", "naive ns", "chunked ns", "speedup");
+
+    for (size_t b = 0; b < sizeof(bases) / sizeof(bases[0]); b++) {
+        int base = bases[b];
+
+        int naive_iters = 20000;
+        double start = now_ns();
+        for (int it = 0; it < naive_iters; it++) {
+            naive_to_string(&values[it % BENCH_VALUES], buffer, base);
+            sink += (uint64_t)buffer[0];
+        }
+        double naive = (now_ns() - start) / naive_iters;
+
+        int fast_iters = 400000;
+        start = now_ns();
+        for (int it = 0; it < fast_iters; it++) {
+            uint512_to_string(&values[it % BENCH_VALUES], buffer, sizeof(buffer), base);
+            sink += (uint64_t)buffer[0];
+        }
+        double fast = (now_ns() - start) / fast_iters;
+
+        printf("  %-6d %12.1f %12.1f %8.1fx\n", base, naive, fast, naive / fast);
+    }
+    printf("\n");
+}
+
+/* The original multiply-per-character parser, kept as a baseline */
+static void naive_from_string(const char *str, uint512_t *result, int base) {
+    uint512_t base_val = {{(uint64_t)base, 0, 0, 0, 0, 0, 0, 0}};
+    *result = UINT512_ZERO;
+    for (; *str; str++) {
+        int digit = (*str <= '9') ? *str - '0' : *str - 'a' + 10;
+        uint512_t temp;
+        uint512_t digit_val = {{(uint64_t)digit, 0, 0, 0, 0, 0, 0, 0}};
+        uint512_mul(result, &base_val, &temp);
+        uint512_add(&temp, &digit_val, result);
+    }
+}
+
+static void bench_from_string(void) {
+    static char strings[BENCH_VALUES][600];
+    static const int bases[] = {10, 16, 2, 36};
+    uint512_t value;
+
+    printf("uint512_from_string (8-limb value)\n");
+    printf("  %-6s %12s %12s %9s\n", "base", "naive ns", "chunked ns", "speedup");
+
+    for (size_t b = 0; b < sizeof(bases) / sizeof(bases[0]); b++) {
+        int base = bases[b];
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            rng_fill(&value, 8);
+            uint512_to_string(&value, strings[i], sizeof(strings[i]), base);
+        }
+
+        int naive_iters = 20000;
+        double start = now_ns();
+        for (int it = 0; it < naive_iters; it++) {
+            naive_from_string(strings[it % BENCH_VALUES], &value, base);
+            sink += value.words[0];
+        }
+        double naive = (now_ns() - start) / naive_iters;
+
+        int fast_iters = 400000;
+        start = now_ns();
+        for (int it = 0; it < fast_iters; it++) {
+            uint512_from_string(strings[it % BENCH_VALUES], &value, base);
+            sink += value.words[0];
+        }
+        double fast = (now_ns() - start) / fast_iters;
+
+        printf("  %-6d %12.1f %12.1f %8.1fx\n", base, naive, fast, naive / fast);
+    }
+    printf("\n");
+}
+
+/* Nibble-at-a-time hex conversion, kept as a baseline */
+static void scalar_to_hex(const uint512_t *value, char *buffer) {
+    static const char digits[] = "0123456789abcdef";
+    for (int i = 0; i < 128; i++) {
+        buffer[i] = digits[(value->words[7 - i / 16] >> (60 - 4 * (i % 16))) & 0xf];
+    }
+    buffer[128] = '\0';
+}
+
+static void scalar_from_hex(const char *str, uint512_t *result) {
+    for (int i = 0; i < 8; i++) {
+        uint64_t x = 0;
+        for (int j = 0; j < 16; j++) {
+            char c = str[16 * (7 - i) + j];
+            x = (x << 4) | (uint64_t)(c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+        }
+        result->words[i] = x;
+    }
+}
+
+static void bench_hex(void) {
+    static uint512_t values[BENCH_VALUES];
+    static char strings[BENCH_VALUES][129];
+    uint512_t value;
+    int iters = 2000000;
+
+    for (int i = 0; i < BENCH_VALUES; i++) {
+        rng_fill(&values[i], 8);
+        uint512_to_hex(&values[i], strings[i], sizeof(strings[i]), 0);
+    }
+
+    printf("Fixed-width hex (128 digits)\n");
+
+    double start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        scalar_to_hex(&values[it % BENCH_VALUES], strings[it % BENCH_VALUES]);
+        sink += (uint64_t)strings[it % BENCH_VALUES][0];
+    }
+    printf("  %-22s %8.1f ns\n", "scalar encode", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_to_hex(&values[it % BENCH_VALUES], strings[it % BENCH_VALUES], 129, 0);
+        sink += (uint64_t)strings[it % BENCH_VALUES][0];
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_to_hex", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        scalar_from_hex(strings[it % BENCH_VALUES], &value);
+        sink += value.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "scalar decode", (now_ns() - start) / iters);
+
+    start = now_ns();
+    for (int it = 0; it < iters; it++) {
+        uint512_from_hex(strings[it % BENCH_VALUES], 128, &value);
+        sink += value.words[0];
+    }
+    printf("  %-22s %8.1f ns\n", "uint512_from_hex", (now_ns() - start) / iters);
+    printf("\n");
+}
+
+static void bench_format(void) {
+    static uint512_t values[BENCH_VALUES];
+    static char output[BENCH_VALUES * 160];
+    char buffer[200];
+    int rounds = 2000;
+
+    for (int i = 0; i < BENCH_VALUES; i++) rng_fill(&values[i], 1 + i % 8);
+
+    printf("Formatting %d decimal values into one buffer\n", BENCH_VALUES);
+
+    double start = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        size_t pos = 0;
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            uint512_to_string(&values[i], buffer, sizeof(buffer), 10);
+            size_t len = strlen(buffer);
+            memcpy(output + pos, buffer, len);
+            pos += len;
+        }
+        sink += pos;
+    }
+    printf("  %-22s %8.1f ns/value\n", "to_string + memcpy", (now_ns() - start) / rounds / BENCH_VALUES);
+
+    start = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        size_t pos = 0;
+        for (int i = 0; i < BENCH_VALUES; i++) {
+            pos += uint512_format(&values[i], output + pos, sizeof(output) - pos, 10);
+        }
+        sink += pos;
+    }
+    printf("  %-22s %8.1f ns/value\n", "uint512_format", (now_ns() - start) / rounds / BENCH_VALUES);
+    printf("\n");
+}
+
+static void bench_batch(void) {
+    enum { COUNT = 4096 };
+    static uint512_t values[COUNT];
+    static uint512_t parsed[COUNT];
+    static char output[COUNT * 160];
+    static char buffer[200];
+    static size_t offsets[COUNT + 1];
+    int rounds = 50;
+
+    for (int i = 0; i < COUNT; i++) rng_fill(&values[i], 1 + i % 8);
+
+    printf("Batch decimal conversion of %d values\n", COUNT);
+
+    double start = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        size_t pos = 0;
+        for (int i = 0; i < COUNT; i++) {
+            uint512_to_string(&values[i], buffer, sizeof(buffer), 10);
+            size_t len = strlen(buffer);
+            memcpy(output + pos, buffer, len);
+            pos += len;
+            offsets[i + 1] = pos;
+        }
+    }
+    printf("  %-26s %8.1f ns/value\n", "uint512_to_string loop", (now_ns() - start) / rounds / COUNT);
+
+    start = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        uint512_to_string_batch(values, COUNT, output, sizeof(output), offsets, 10);
+    }
+    printf("  %-26s %8.1f ns/value\n", "uint512_to_string_batch", (now_ns() - start) / rounds / COUNT);
+
+    start = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < COUNT; i++) {
+            size_t len = offsets[i + 1] - offsets[i];
+            memcpy(buffer, output + offsets[i], len);
+            buffer[len] = '\0';
+            uint512_from_string(buffer, &parsed[i], 10);
+        }
+    }
+    printf("  %-26s %8.1f ns/value\n", "uint512_from_string loop", (now_ns() - start) / rounds / COUNT);
+
+    start = now_ns();
+    for (int r = 0; r < rounds; r++) {
+        uint512_from_string_batch(output, offsets, COUNT, parsed, NULL, 10);
+    }
+    printf("  %-26s %8.1f ns/value\n", "uint512_from_string_batch", (now_ns() - start) / rounds / COUNT);
+    sink += parsed[COUNT - 1].words[0];
+    printf("\n");
+}
+
+static void bench_batch_arith(void) {
+    enum { COUNT = 4096 };
+    static uint512_t a[COUNT], b[COUNT], r[COUNT];
+    static uint64_t planes[3][8][COUNT];
+    static uint64_t status[COUNT / 64];
+    static int8_t cmp[COUNT];
+    uint512_soa_t sa, sb, sr;
+    int rounds = 200;
+
+    for (int i = 0; i < COUNT; i++) {
+        rng_fill(&a[i], 4);
+        rng_fill(&b[i], 4);
+        for (int k = 0; k < 8; k++) {
+            planes[0][k][i] = a[i].words[k];
+            planes[1][k][i] = b[i].words[k];
+        }
+    }
+    for (int k = 0; k < 8; k++) {
+        sa.limbs[k] = planes[0][k];
+        sb.limbs[k] = planes[1][k];
+        sr.limbs[k] = planes[2][k];
+    }
+
+    printf("Batch arithmetic over %d values (ns/element)\n", COUNT);
+    printf("  %-10s %10s %10s %10s\n", "op", "loop", "_n", "_n_soa");
+
+    for (int op = 0; op < 4; op++) {
+        static const char *names[] = {"add", "sub", "mul", "cmp"};
+        double t[3];
+        for (int variant = 0; variant < 3; variant++) {
+            double start = now_ns();
+            for (int round = 0; round < rounds; round++) {
+                if (variant == 0) {
+                    for (int i = 0; i < COUNT; i++) {
+                        switch (op) {
+                        case 0: uint512_add(&a[i], &b[i], &r[i]); break;
+                        case 1: uint512_sub(&a[i], &b[i], &r[i]); break;
+                        case 2: uint512_mul(&a[i], &b[i], &r[i]); break;
+                        default: cmp[i] = (int8_t)uint512_compare(&a[i], &b[i]); break;
+                        }
+                    }
+                } else if (variant == 1) {
+                    switch (op) {
+                    case 0: uint512_add_n(a, b, r, COUNT, status); break;
+                    case 1: uint512_sub_n(a, b, r, COUNT, status); break;
+                    case 2: uint512_mul_n(a, b, r, COUNT, status); break;
+                    default: uint512_cmp_n(a, b, cmp, COUNT); break;
+                    }
+                } else {
+                    switch (op) {
+                    case 0: uint512_add_n_soa(&sa, &sb, &sr, COUNT, status); break;
+                    case 1: uint512_sub_n_soa(&sa, &sb, &sr, COUNT, status); break;
+                    case 2: uint512_mul_n_soa(&sa, &sb, &sr, COUNT, status); break;
+                    default: uint512_cmp_n_soa(&sa, &sb, cmp, COUNT); break;
+                    }
+                }
+                sink += r[round % COUNT].words[0] + planes[2][0][round % COUNT] + (uint64_t)cmp[round % COUNT];
+            }
+            t[variant] = (now_ns() - start) / rounds / COUNT;
+        }
+        printf("  %-10s %10.2f %10.2f %10.2f\n", names[op], t[0], t[1], t[2]);
+    }
+    printf("\n");
+}
+
+/* Scalar uint512_mul per element against uint512_mul_n, which uses the
+   IFMA engine when the CPU has it; the IFMA cost does not depend on the
+   operand widths, the scalar kernels' does */
+static void bench_mul_n(void) {
+    enum { COUNT = 4096 };
+    static uint512_t a[COUNT], b[COUNT], r[COUNT];
+    static uint64_t status[COUNT / 64];
+    static const int widths[][2] = {{2, 2}, {4, 4}, {6, 2}, {8, 8}};
+    int rounds = 200;
+
+    printf("Batched multiplication over %d values (ns/element)\n", COUNT);
+    printf("  %-10s %10s %10s %10s\n", "limbs", "mul", "mul_n", "speedup");
+
+    for (size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++) {
+        for (int i = 0; i < COUNT; i++) {
+            rng_fill(&a[i], widths[w][0]);
+            rng_fill(&b[i], widths[w][1]);
+        }
+
+        double start = now_ns();
+        for (int round = 0; round < rounds; round++) {
+            for (int i = 0; i < COUNT; i++) uint512_mul(&a[i], &b[i], &r[i]);
+            sink += r[round % COUNT].words[0];
+        }
+        double t_mul = (now_ns() - start) / rounds / COUNT;
+
+        start = now_ns();
+        for (int round = 0; round < rounds; round++) {
+            uint512_mul_n(a, b, r, COUNT, status);
+            sink += r[round % COUNT].words[0];
+        }
+        double t_mul_n = (now_ns() - start) / rounds / COUNT;
+
+        char label[16];
+        snprintf(label, sizeof(label), "%dx%d", widths[w][0], widths[w][1]);
+        printf("  %-10s %10.2f %10.2f %9.2fx\n", label, t_mul, t_mul_n, t_mul / t_mul_n);
+    }
+    printf("\n");
+}
+
+/* Sequential loops of int512_add / int512_mul against the reductions on
+   one thread and on all processors */
+static void bench_reduce(void) {
+    enum { COUNT = 1 << 19 };
+    static int512_t a[COUNT], b[COUNT];
+    int rounds = 5;
+
+    for (int i = 0; i < COUNT; i++) {
+        rng_fill((uint512_t *)&a[i], 6);
+        rng_fill((uint512_t *)&b[i], 3);
+    }
+
+    printf("Reductions over %d values (ns/element)\n", COUNT);
+    printf("  %-10s %10s %10s %10s\n", "op", "loop", "1 thread", "all");
+
+    for (int op = 0; op < 2; op++) {
+        double t[3];
+        for (int variant = 0; variant < 3; variant++) {
+            double start = now_ns();
+            for (int round = 0; round < rounds; round++) {
+                int512_t acc = INT512_ZERO;
+                if (variant == 0) {
+                    for (int i = 0; i < COUNT; i++) {
+                        if (op == 0) {
+                            int512_add(&acc, &a[i], &acc);
+                        } else {
+                            int512_t p;
+                            int512_mul(&a[i], &b[i], &p);
+                            int512_add(&acc, &p, &acc);
+                        }
+                    }
+                } else if (op == 0) {
+                    int512_sum_array(a, COUNT, &acc, variant == 1 ? 1 : 0);
+                } else {
+                    int512_dot_array(a, b, COUNT, &acc, variant == 1 ? 1 : 0);
+                }
+                sink += acc.words[0];
+            }
+            t[variant] = (now_ns() - start) / rounds / COUNT;
+        }
+        printf("  %-10s %10.2f %10.2f %10.2f\n", op == 0 ? "sum" : "dot", t[0], t[1], t[2]);
+    }
+    printf("\n");
+}
+
+int main(void) {
+    bench_add();
+    bench_mul();
+    bench_mixed();
+    bench_karatsuba();
+    bench_div();
+    bench_div_u64();
+    bench_div_by();
+    bench_mont();
+    bench_barrett();
+    bench_powmod();
+    bench_gcd();
+    bench_roots();
+    bench_prime();
+    bench_to_string();
+    bench_from_string();
+    bench_hex();
+    bench_format();
+    bench_batch();
+    bench_batch_arith();
+    bench_mul_n();
+    bench_reduce();
+    return 0;
+}
@@ -2,6 +2,15 @@
 #include <string.h>
 #include <ctype.h>
 #include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define INT512_X86 1
+#endif
 
 /* ============================================================================
  * Constants
@@ -57,632 +66,4187 @@ int int512_compare(const int512_t *a, const int512_t *b) {
 }
 
 /* ============================================================================
- * Unsigned Arithmetic Operations
+ * Limb Kernels
+ *
+ * Internal helpers operating on little-endian arrays of 64-bit limbs.  They
+ * take explicit lengths so callers only pay for the limbs actually in use.
  * ============================================================================ */
 
-int512_error_t uint512_add(const uint512_t *a, const uint512_t *b, uint512_t *result) {
-    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
-
-    uint64_t carry = 0;
-    for (int i = 0; i < 8; i++) {
-        uint64_t sum = a->words[i] + carry;
-        carry = (sum < carry) ? 1 : 0;
-        sum += b->words[i];
-        carry += (sum < b->words[i]) ? 1 : 0;
-        result->words[i] = sum;
-    }
+/* Largest limb count handled by the internal kernels */
+#define LIMBS_MAX 16
 
-    return carry ? INT512_ERR_OVERFLOW : INT512_OK;
+/* Number of significant limbs in w[0..n-1] (0 if all are zero) */
+static int limbs_count(const uint64_t *w, int n) {
+    while (n > 0 && w[n - 1] == 0) n--;
+    return n;
 }
 
-int512_error_t uint512_sub(const uint512_t *a, const uint512_t *b, uint512_t *result) {
-    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+/* Number of leading zero bits in a non-zero limb */
+static int limb_clz(uint64_t x) {
+    return __builtin_clzll(x);
+}
 
-    uint64_t borrow = 0;
-    for (int i = 0; i < 8; i++) {
-        uint64_t diff = a->words[i] - borrow;
-        borrow = (diff > a->words[i]) ? 1 : 0;
-        uint64_t temp = diff - b->words[i];
-        borrow += (temp > diff) ? 1 : 0;
-        result->words[i] = temp;
-    }
+/* Number of trailing zero bits in a non-zero limb */
+static int limb_ctz(uint64_t x) {
+    return __builtin_ctzll(x);
+}
 
-    return borrow ? INT512_ERR_UNDERFLOW : INT512_OK;
+/* Bit i of w */
+static int limbs_bit(const uint64_t *w, int i) {
+    return (int)((w[i / 64] >> (i % 64)) & 1);
 }
 
-int512_error_t uint512_mul(const uint512_t *a, const uint512_t *b, uint512_t *result) {
-    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+/* Position of the highest set bit of w[0..n-1] plus one (0 if all are zero) */
+static int limbs_bit_length(const uint64_t *w, int n) {
+    int m = limbs_count(w, n);
+    return m == 0 ? 0 : 64 * m - limb_clz(w[m - 1]);
+}
 
-    uint512_t temp = UINT512_ZERO;
-    bool overflow = false;
+/* Converts a limb loaded from little-endian memory to native order */
+static uint64_t int512_le64(uint64_t x) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return __builtin_bswap64(x);
+#else
+    return x;
+#endif
+}
 
-    for (int i = 0; i < 8; i++) {
-        if (b->words[i] == 0) continue;
+/*
+ * Add and subtract with carry over one limb.  On x86-64 these are the
+ * ADC/SBB intrinsics; elsewhere the compiler's overflow builtins, which
+ * usually lower to the target's carry instructions.
+ */
+static inline uint64_t limb_addc(uint64_t a, uint64_t b, uint64_t carry_in, uint64_t *carry_out) {
+#ifdef INT512_X86
+    unsigned long long sum;
+    *carry_out = _addcarry_u64((unsigned char)carry_in, a, b, &sum);
+    return sum;
+#else
+    uint64_t sum;
+    uint64_t c1 = __builtin_add_overflow(a, b, &sum);
+    uint64_t c2 = __builtin_add_overflow(sum, carry_in, &sum);
+    *carry_out = c1 | c2;
+    return sum;
+#endif
+}
 
-        uint64_t carry = 0;
-        for (int j = 0; j < 8; j++) {
-            if (i + j >= 8) {
-                if (a->words[j] != 0) overflow = true;
-                continue;
-            }
+static inline uint64_t limb_subb(uint64_t a, uint64_t b, uint64_t borrow_in, uint64_t *borrow_out) {
+#ifdef INT512_X86
+    unsigned long long diff;
+    *borrow_out = _subborrow_u64((unsigned char)borrow_in, a, b, &diff);
+    return diff;
+#else
+    uint64_t diff;
+    uint64_t b1 = __builtin_sub_overflow(a, b, &diff);
+    uint64_t b2 = __builtin_sub_overflow(diff, borrow_in, &diff);
+    *borrow_out = b1 | b2;
+    return diff;
+#endif
+}
 
-            /* Multiply with 128-bit intermediate */
-            __uint128_t prod = (__uint128_t)a->words[j] * b->words[i] + temp.words[i + j] + carry;
-            temp.words[i + j] = (uint64_t)prod;
-            carry = (uint64_t)(prod >> 64);
-        }
-        if (carry != 0) overflow = true;
+/*
+ * r = a + b over 8 limbs as one unrolled carry chain; returns the carry out.
+ * r may alias a or b.  On x86-64 the intrinsic stores each limb straight to
+ * r: going through limb_addc's local makes GCC keep that local in memory
+ * once the chain is inlined into a loop, which doubles the stores.
+ */
+static inline uint64_t limbs_add_8(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+#ifdef INT512_X86
+    unsigned char carry = 0;
+#pragma GCC unroll 8
+    for (int i = 0; i < 8; i++) {
+        carry = _addcarry_u64(carry, a[i], b[i], (unsigned long long *)&r[i]);
+    }
+#else
+    uint64_t carry = 0;
+#pragma GCC unroll 8
+    for (int i = 0; i < 8; i++) {
+        r[i] = limb_addc(a[i], b[i], carry, &carry);
     }
+#endif
+    return carry;
+}
 
-    *result = temp;
-    return overflow ? INT512_ERR_OVERFLOW : INT512_OK;
+/* r = a - b over 8 limbs; returns the borrow out */
+static inline uint64_t limbs_sub_8(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+#ifdef INT512_X86
+    unsigned char borrow = 0;
+#pragma GCC unroll 8
+    for (int i = 0; i < 8; i++) {
+        borrow = _subborrow_u64(borrow, a[i], b[i], (unsigned long long *)&r[i]);
+    }
+#else
+    uint64_t borrow = 0;
+#pragma GCC unroll 8
+    for (int i = 0; i < 8; i++) {
+        r[i] = limb_subb(a[i], b[i], borrow, &borrow);
+    }
+#endif
+    return borrow;
 }
 
-int512_error_t uint512_div(const uint512_t *a, const uint512_t *b, uint512_t *quotient, uint512_t *remainder) {
-    if (!a || !b || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
-    if (uint512_is_zero(b)) return INT512_ERR_DIVIDE_BY_ZERO;
+/*
+ * r = a + b over 8 limbs, where b has bn limbs and is extended upwards with
+ * the fill limb ext (0, or ~0 for a negative two's complement b).  Adding
+ * the fill with a carry equal to its low bit leaves the limb unchanged and
+ * passes the same carry on, so the chain stops as soon as that happens.
+ * a is copied into r first and the chain runs in place.  r may alias a but
+ * not b; returns the carry out.
+ */
+static uint64_t limbs_add_ext(uint64_t *r, const uint64_t *a, const uint64_t *b, int bn, uint64_t ext) {
+    if (r != a) memcpy(r, a, 8 * sizeof(uint64_t));
 
-    *quotient = UINT512_ZERO;
-    *remainder = *a;
+    uint64_t carry = 0;
+    int i;
+    for (i = 0; i < bn; i++) {
+        r[i] = limb_addc(r[i], b[i], carry, &carry);
+    }
+    for (; i < 8 && carry != (ext & 1); i++) {
+        r[i] = limb_addc(r[i], ext, carry, &carry);
+    }
+    return carry;
+}
 
-    if (uint512_compare(a, b) < 0) return INT512_OK;
+/* r = a - b with b extended by ext as above; returns the borrow out */
+static uint64_t limbs_sub_ext(uint64_t *r, const uint64_t *a, const uint64_t *b, int bn, uint64_t ext) {
+    if (r != a) memcpy(r, a, 8 * sizeof(uint64_t));
 
-    /* Find highest set bit in dividend */
-    int dividend_bits = 512;
-    for (int i = 7; i >= 0; i--) {
-        if (a->words[i] != 0) {
-            dividend_bits = i * 64 + 63;
-            uint64_t word = a->words[i];
-            while (!(word & ((uint64_t)1 << (dividend_bits % 64)))) {
-                dividend_bits--;
-            }
-            break;
-        }
+    uint64_t borrow = 0;
+    int i;
+    for (i = 0; i < bn; i++) {
+        r[i] = limb_subb(r[i], b[i], borrow, &borrow);
     }
-
-    /* Find highest set bit in divisor */
-    int divisor_bits = 512;
-    for (int i = 7; i >= 0; i--) {
-        if (b->words[i] != 0) {
-            divisor_bits = i * 64 + 63;
-            uint64_t word = b->words[i];
-            while (!(word & ((uint64_t)1 << (divisor_bits % 64)))) {
-                divisor_bits--;
-            }
-            break;
-        }
+    for (; i < 8 && borrow != (ext & 1); i++) {
+        r[i] = limb_subb(r[i], ext, borrow, &borrow);
     }
+    return borrow;
+}
 
-    /* Long division */
-    uint512_t current = UINT512_ZERO;
-    for (int i = dividend_bits; i >= 0; i--) {
-        /* Shift current left by 1 */
-        uint64_t carry = 0;
-        for (int j = 0; j < 8; j++) {
-            uint64_t new_carry = (current.words[j] >> 63);
-            current.words[j] = (current.words[j] << 1) | carry;
-            carry = new_carry;
-        }
+/* r[0..n-1] = a * mul + add, returns the limb carried out of the top.
+   r may alias a. */
+static uint64_t limbs_mul_1_add(uint64_t *r, const uint64_t *a, int n, uint64_t mul, uint64_t add) {
+    uint64_t carry = add;
+    for (int i = 0; i < n; i++) {
+        __uint128_t t = (__uint128_t)a[i] * mul + carry;
+        r[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+    return carry;
+}
 
-        /* Set lowest bit to bit i of dividend */
-        int word_idx = i / 64;
-        int bit_idx = i % 64;
-        if (a->words[word_idx] & ((uint64_t)1 << bit_idx)) {
-            current.words[0] |= 1;
-        }
+/* r[0..n-1] += a * mul, returns the limb carried out of the top */
+static uint64_t limbs_addmul_1(uint64_t *r, const uint64_t *a, int n, uint64_t mul) {
+    uint64_t carry = 0;
+    for (int i = 0; i < n; i++) {
+        __uint128_t t = (__uint128_t)a[i] * mul + r[i] + carry;
+        r[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+    return carry;
+}
 
-        /* If current >= divisor, subtract and set quotient bit */
-        if (uint512_compare(&current, b) >= 0) {
-            uint512_sub(&current, b, &current);
-            word_idx = i / 64;
-            bit_idx = i % 64;
-            quotient->words[word_idx] |= ((uint64_t)1 << bit_idx);
-        }
+/*
+ * r = a * b for an 8-limb a and a b of one or two limbs, in a single pass
+ * per limb of b.  Returns nonzero when the product does not fit in 8
+ * limbs.  r may alias a.
+ */
+static uint64_t limbs_mul_small(uint64_t *r, const uint64_t *a, const uint64_t *b, int bn) {
+    if (bn == 1) {
+        return limbs_mul_1_add(r, a, 8, b[0], 0);
     }
+    uint64_t src[8];
+    memcpy(src, a, sizeof(src));
+    uint64_t over = limbs_mul_1_add(r, src, 8, b[0], 0);
+    if (b[1] != 0) {
+        over |= limbs_addmul_1(r + 1, src, 7, b[1]);
+        over |= src[7];
+    }
+    return over;
+}
 
-    *remainder = current;
-    return INT512_OK;
+/* r = a + b over n limbs; returns the carry out.  r may alias a or b. */
+static uint64_t limbs_add_n(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    uint64_t carry = 0;
+    for (int i = 0; i < n; i++) {
+        r[i] = limb_addc(a[i], b[i], carry, &carry);
+    }
+    return carry;
 }
 
-/* ============================================================================
- * Signed Arithmetic Operations
- * ============================================================================ */
+/* r = a - b over n limbs; returns the borrow out */
+static uint64_t limbs_sub_n(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < n; i++) {
+        r[i] = limb_subb(a[i], b[i], borrow, &borrow);
+    }
+    return borrow;
+}
 
-static void int512_negate(int512_t *a) {
-    /* Two's complement: flip bits and add 1 */
-    for (int i = 0; i < 8; i++) {
-        a->words[i] = ~a->words[i];
+/* Adds carry into r[0..n-1], stopping once it dies */
+static void limbs_incr(uint64_t *r, int n, uint64_t carry) {
+    for (int i = 0; carry && i < n; i++) {
+        r[i] += carry;
+        carry = r[i] < carry;
     }
-    uint64_t carry = 1;
-    for (int i = 0; i < 8; i++) {
-        uint64_t sum = a->words[i] + carry;
-        carry = (sum < a->words[i]) ? 1 : 0;
-        a->words[i] = sum;
+}
+
+static int limbs_cmp(const uint64_t *a, const uint64_t *b, int n) {
+    for (int i = n - 1; i >= 0; i--) {
+        if (a[i] != b[i]) return a[i] > b[i] ? 1 : -1;
     }
+    return 0;
 }
 
-int512_error_t int512_add(const int512_t *a, const int512_t *b, int512_t *result) {
-    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+/* 128/64 division: requires hi < d so the quotient fits in one limb */
+static uint64_t limb_div_2by1(uint64_t hi, uint64_t lo, uint64_t d, uint64_t *rem) {
+    __uint128_t num = ((__uint128_t)hi << 64) | lo;
+    uint64_t q = (uint64_t)(num / d);
+    *rem = (uint64_t)(num - (__uint128_t)q * d);
+    return q;
+}
 
-    bool a_neg = int512_is_negative(a);
-    bool b_neg = int512_is_negative(b);
+/*
+ * Möller & Granlund, "Improved division by invariant integers" (2011).
+ * For a normalized d (top bit set) returns v = floor((2^128 - 1) / d) - 2^64.
+ */
+static uint64_t limb_reciprocal(uint64_t d) {
+    uint64_t r;
+    return limb_div_2by1(~d, UINT64_MAX, d, &r);
+}
 
-    uint512_add((const uint512_t *)a, (const uint512_t *)b, (uint512_t *)result);
+/* 128/64 division by a normalized d with reciprocal v; requires hi < d */
+static uint64_t limb_div_2by1_preinv(uint64_t hi, uint64_t lo, uint64_t d, uint64_t v, uint64_t *rem) {
+    __uint128_t qq = (__uint128_t)v * hi + (((__uint128_t)hi << 64) | lo);
+    uint64_t q = (uint64_t)(qq >> 64) + 1;
+    uint64_t q0 = (uint64_t)qq;
+    uint64_t r = lo - q * d;
+    if (r > q0) {
+        q--;
+        r += d;
+    }
+    if (r >= d) {
+        q++;
+        r -= d;
+    }
+    *rem = r;
+    return q;
+}
 
-    bool result_neg = int512_is_negative(result);
+/*
+ * q[0..n-1] = a[0..n-1] / d, returns a mod d, where d << shift is the
+ * normalized divisor dn with reciprocal v.  The dividend is shifted on the
+ * fly.  q may alias a, or be NULL when only the remainder is wanted.
+ */
+static uint64_t limbs_divrem_1_preinv(uint64_t *q, const uint64_t *a, int n, uint64_t dn, uint64_t v, int shift) {
+    if (n == 0) return 0;
+
+    uint64_t r, qi;
+    if (shift == 0) {
+        r = 0;
+        for (int i = n - 1; i >= 0; i--) {
+            qi = limb_div_2by1_preinv(r, a[i], dn, v, &r);
+            if (q) q[i] = qi;
+        }
+        return r;
+    }
 
-    /* Check for overflow: same sign inputs produce different sign output */
-    if (a_neg == b_neg && a_neg != result_neg) {
-        return a_neg ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
+    r = a[n - 1] >> (64 - shift);
+    for (int i = n - 1; i > 0; i--) {
+        uint64_t lo = (a[i] << shift) | (a[i - 1] >> (64 - shift));
+        qi = limb_div_2by1_preinv(r, lo, dn, v, &r);
+        if (q) q[i] = qi;
     }
+    qi = limb_div_2by1_preinv(r, a[0] << shift, dn, v, &r);
+    if (q) q[0] = qi;
+    return r >> shift;
+}
 
-    return INT512_OK;
+/* q[0..n-1] = a[0..n-1] / d, returns a mod d.  q may alias a or be NULL. */
+static uint64_t limbs_divrem_1(uint64_t *q, const uint64_t *a, int n, uint64_t d) {
+    int shift = limb_clz(d);
+    uint64_t dn = d << shift;
+    return limbs_divrem_1_preinv(q, a, n, dn, limb_reciprocal(dn), shift);
 }
 
-int512_error_t int512_sub(const int512_t *a, const int512_t *b, int512_t *result) {
-    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+/*
+ * r[0..n-1] = a[0..n-1] << s for 0 <= s < 64, returns the bits shifted out
+ * of the top limb.  r may alias a.
+ */
+static uint64_t limbs_lshift(uint64_t *r, const uint64_t *a, int n, int s) {
+    if (n == 0) return 0;
+    if (s == 0) {
+        memmove(r, a, (size_t)n * sizeof(uint64_t));
+        return 0;
+    }
+    uint64_t out = a[n - 1] >> (64 - s);
+    for (int i = n - 1; i > 0; i--) {
+        r[i] = (a[i] << s) | (a[i - 1] >> (64 - s));
+    }
+    r[0] = a[0] << s;
+    return out;
+}
 
-    bool a_neg = int512_is_negative(a);
-    bool b_neg = int512_is_negative(b);
+/* r[0..n-1] = a[0..n-1] >> s for 0 <= s < 64.  r may alias a. */
+static void limbs_rshift(uint64_t *r, const uint64_t *a, int n, int s) {
+    if (n == 0) return;
+    if (s == 0) {
+        memmove(r, a, (size_t)n * sizeof(uint64_t));
+        return;
+    }
+    for (int i = 0; i < n - 1; i++) {
+        r[i] = (a[i] >> s) | (a[i + 1] << (64 - s));
+    }
+    r[n - 1] = a[n - 1] >> s;
+}
 
-    uint512_sub((const uint512_t *)a, (const uint512_t *)b, (uint512_t *)result);
+/*
+ * Knuth, TAOCP vol. 2, 4.3.1, Algorithm D, main loop.
+ *
+ * Divides un[0..m] by the normalized divisor vn[0..n-1] (n >= 2, top bit of
+ * vn[n-1] set) where v is the reciprocal of vn[n-1] and un[m] < vn[n-1].
+ * The quotient digits go to q[0..m-n] when q is non-NULL; the remainder is
+ * left in un[0..n-1].  Normalization keeps each estimated quotient digit at
+ * most two too large; the estimate is refined against the second divisor
+ * limb and fixed up with a single add-back in the rare case it is still one
+ * too big.
+ */
+static void limbs_divmod_norm(uint64_t *q, uint64_t *un, int m, const uint64_t *vn, int n, uint64_t v) {
+    uint64_t d1 = vn[n - 1];
+    uint64_t d0 = vn[n - 2];
+
+    for (int j = m - n; j >= 0; j--) {
+        /* Estimate quotient digit from the top two limbs of the remainder */
+        uint64_t qhat, rhat;
+        bool rhat_overflow = false;
+        if (un[j + n] >= d1) {
+            qhat = UINT64_MAX;
+            rhat = un[j + n - 1] + d1;
+            rhat_overflow = rhat < d1;
+        } else {
+            qhat = limb_div_2by1_preinv(un[j + n], un[j + n - 1], d1, v, &rhat);
+        }
 
-    bool result_neg = int512_is_negative(result);
+        while (!rhat_overflow &&
+               (__uint128_t)qhat * d0 > (((__uint128_t)rhat << 64) | un[j + n - 2])) {
+            qhat--;
+            rhat += d1;
+            rhat_overflow = rhat < d1;
+        }
 
-    /* Check for overflow: a - b where a and b have different signs */
-    if (a_neg != b_neg && a_neg != result_neg) {
-        return a_neg ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
-    }
+        /* Multiply and subtract.  The borrow folds into the product carry
+           without overflow: a high half of 2^64 - 1 implies a zero low half. */
+        uint64_t carry = 0;
+        for (int i = 0; i < n; i++) {
+            __uint128_t p = (__uint128_t)qhat * vn[i] + carry;
+            uint64_t plo = (uint64_t)p;
+            uint64_t t = un[i + j] - plo;
+            carry = (uint64_t)(p >> 64) + (t > un[i + j]);
+            un[i + j] = t;
+        }
+        uint64_t top = un[j + n];
+        un[j + n] = top - carry;
+
+        /* Add back if the estimate was still one too large */
+        if (top < carry) {
+            qhat--;
+            uint64_t c = 0;
+            for (int i = 0; i < n; i++) {
+                __uint128_t sum = (__uint128_t)un[i + j] + vn[i] + c;
+                un[i + j] = (uint64_t)sum;
+                c = (uint64_t)(sum >> 64);
+            }
+            un[j + n] += c;
+        }
 
-    return INT512_OK;
+        if (q) q[j] = qhat;
+    }
 }
 
-int512_error_t int512_mul(const int512_t *a, const int512_t *b, int512_t *result) {
-    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+/*
+ * Divides u[0..m-1] by v[0..n-1] where n >= 2, v[n-1] != 0 and m >= n.
+ * q receives m-n+1 limbs and r receives n limbs.
+ */
+static void limbs_divmod(uint64_t *q, uint64_t *r, const uint64_t *u, int m, const uint64_t *v, int n) {
+    uint64_t vn[LIMBS_MAX];
+    uint64_t un[LIMBS_MAX + 1];
+    int s = limb_clz(v[n - 1]);
 
-    int512_t abs_a = *a;
-    int512_t abs_b = *b;
-    bool negate_result = false;
+    limbs_lshift(vn, v, n, s);
+    un[m] = limbs_lshift(un, u, m, s);
 
-    if (int512_is_negative(a)) {
-        int512_negate(&abs_a);
-        negate_result = !negate_result;
-    }
-    if (int512_is_negative(b)) {
-        int512_negate(&abs_b);
-        negate_result = !negate_result;
-    }
+    limbs_divmod_norm(q, un, m, vn, n, limb_reciprocal(vn[n - 1]));
 
-    int512_error_t err = uint512_mul((const uint512_t *)&abs_a, (const uint512_t *)&abs_b, (uint512_t *)result);
+    limbs_rshift(r, un, n, s);
+}
 
-    if (negate_result) {
-        int512_negate(result);
+/*
+ * Product scanning (Comba) multiplication: r[0..rn-1] receives the low rn
+ * limbs of a[0..an-1] * b[0..bn-1], one column at a time with a three-limb
+ * accumulator.  Returns nonzero if the product does not fit in rn limbs,
+ * which relies on a[an-1] and b[bn-1] being nonzero when an + bn - 1 > rn.
+ * r must not overlap a or b.
+ *
+ * The kernel is always inlined so that callers passing constant lengths get
+ * a fully unrolled instance.
+ */
+static inline __attribute__((always_inline))
+uint64_t limbs_mul_comba(uint64_t *r, int rn, const uint64_t *a, int an, const uint64_t *b, int bn) {
+    if (an == 0 || bn == 0) {
+        memset(r, 0, (size_t)rn * sizeof(uint64_t));
+        return 0;
     }
 
-    /* Check for overflow */
-    if (err == INT512_ERR_OVERFLOW) return INT512_ERR_OVERFLOW;
-    if (!negate_result && int512_is_negative(result)) return INT512_ERR_OVERFLOW;
-    if (negate_result && !int512_is_negative(result) && !int512_is_zero(result)) return INT512_ERR_OVERFLOW;
+    int columns = an + bn - 1;
+    int k_end = columns < rn ? columns : rn;
+    __uint128_t acc = 0;
+    uint64_t acc_top = 0;
+
+#pragma GCC unroll 16
+    for (int k = 0; k < k_end; k++) {
+        int i_start = k < bn ? 0 : k - bn + 1;
+        int i_end = k < an ? k : an - 1;
+#pragma GCC unroll 8
+        for (int i = i_start; i <= i_end; i++) {
+            __uint128_t prod = (__uint128_t)a[i] * b[k - i];
+            acc += prod;
+            acc_top += acc < prod;
+        }
+        r[k] = (uint64_t)acc;
+        acc = (acc >> 64) | ((__uint128_t)acc_top << 64);
+        acc_top = 0;
+    }
+    for (int k = k_end; k < rn; k++) {
+        r[k] = (uint64_t)acc;
+        acc >>= 64;
+    }
 
-    return INT512_OK;
+    /* A product term in column rn or beyond is at least 2^(64 rn) */
+    return (columns > rn) | (acc != 0);
 }
 
-int512_error_t int512_div(const int512_t *a, const int512_t *b, int512_t *quotient, int512_t *remainder) {
-    if (!a || !b || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
-    if (int512_is_zero(b)) return INT512_ERR_DIVIDE_BY_ZERO;
+/*
+ * Comba squaring, same contract as limbs_mul_comba with b = a.  Each
+ * off-diagonal product a[i] * a[j] (i < j) is computed once and the column
+ * sum doubled before the diagonal square is added.
+ */
+static inline __attribute__((always_inline))
+uint64_t limbs_sqr_comba(uint64_t *r, int rn, const uint64_t *a, int an) {
+    if (an == 0) {
+        memset(r, 0, (size_t)rn * sizeof(uint64_t));
+        return 0;
+    }
 
-    int512_t abs_a = *a;
-    int512_t abs_b = *b;
-    bool negate_quotient = false;
-    bool negate_remainder = false;
+    int columns = 2 * an - 1;
+    int k_end = columns < rn ? columns : rn;
+    __uint128_t acc = 0;
+    uint64_t acc_top = 0;
+
+#pragma GCC unroll 16
+    for (int k = 0; k < k_end; k++) {
+        int i_start = k < an ? 0 : k - an + 1;
+        __uint128_t col = 0;
+        uint64_t col_top = 0;
+#pragma GCC unroll 8
+        for (int i = i_start; i < k - i; i++) {
+            __uint128_t prod = (__uint128_t)a[i] * a[k - i];
+            col += prod;
+            col_top += col < prod;
+        }
+        col_top = (col_top << 1) | (uint64_t)(col >> 127);
+        col <<= 1;
+        if ((k & 1) == 0) {
+            __uint128_t diag = (__uint128_t)a[k / 2] * a[k / 2];
+            col += diag;
+            col_top += col < diag;
+        }
+        acc += col;
+        acc_top += col_top + (acc < col);
 
-    if (int512_is_negative(a)) {
-        int512_negate(&abs_a);
-        negate_quotient = !negate_quotient;
-        negate_remainder = true;
+        r[k] = (uint64_t)acc;
+        acc = (acc >> 64) | ((__uint128_t)acc_top << 64);
+        acc_top = 0;
     }
-    if (int512_is_negative(b)) {
-        int512_negate(&abs_b);
-        negate_quotient = !negate_quotient;
+    for (int k = k_end; k < rn; k++) {
+        r[k] = (uint64_t)acc;
+        acc >>= 64;
     }
 
-    int512_error_t err = uint512_div((const uint512_t *)&abs_a, (const uint512_t *)&abs_b,
-                                     (uint512_t *)quotient, (uint512_t *)remainder);
-
-    if (err != INT512_OK) return err;
+    return (columns > rn) | (acc != 0);
+}
 
-    if (negate_quotient) {
-        int512_negate(quotient);
+/*
+ * Final step of a Montgomery reduction modulo an n-limb odd m, R = 2^(64 n):
+ * r = t - m if t + top * R >= m, else t, where t + top * R is below 2m.
+ * Selects with a mask rather than a branch on the value.
+ */
+static inline __attribute__((always_inline))
+void mont_reduce_once(uint64_t *r, const uint64_t *t, uint64_t top, const uint64_t *m, int n) {
+    uint64_t d[8];
+    uint64_t borrow = 0;
+    for (int j = 0; j < n; j++) {
+        d[j] = limb_subb(t[j], m[j], borrow, &borrow);
     }
-    if (negate_remainder) {
-        int512_negate(remainder);
+    uint64_t keep = (uint64_t)0 - (borrow & (top ^ 1));
+    for (int j = 0; j < n; j++) {
+        r[j] = (t[j] & keep) | (d[j] & ~keep);
     }
+}
 
-    return INT512_OK;
+/* r = t / R mod m for t = t[0..2n-1] < m R; t is overwritten */
+static inline __attribute__((always_inline))
+void mont_redc(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t m_inv, int n) {
+    uint64_t hi = 0;
+#pragma GCC unroll 8
+    for (int i = 0; i < n; i++) {
+        uint64_t q = t[i] * m_inv;
+        uint64_t c = 0;
+#pragma GCC unroll 8
+        for (int j = 0; j < n; j++) {
+            __uint128_t p = (__uint128_t)q * m[j] + t[i + j] + c;
+            t[i + j] = (uint64_t)p;
+            c = (uint64_t)(p >> 64);
+        }
+        t[i + n] = limb_addc(t[i + n], c, hi, &hi);
+    }
+    mont_reduce_once(r, t + n, hi, m, n);
 }
 
 /* ============================================================================
- * Mixed-size Unsigned Operations
- * ============================================================================ */
+ * Multiplication Kernels
+ * ============================================================================
+ *
+ * Fixed-size products used by the multiply and square entry points:
+ * 8x8 and 4x4 limb products and 8 and 4 limb squares, each writing the full
+ * double-length result, the low 8 limbs of an 8x8 product, plus the
+ * Montgomery reductions of such a result modulo an 8 or 4 limb odd modulus.  The portable versions are instances
+ * of the Comba and reduction kernels above.  On x86-64 CPUs with BMI2 and
+ * ADX the MULX versions are selected when the library is loaded; they run
+ * two independent carry chains, ADCX through the carry flag and ADOX
+ * through the overflow flag.
+ */
+
+typedef struct {
+    void (*mul_8x8)(uint64_t *r, const uint64_t *a, const uint64_t *b);
+    void (*mul_4x4)(uint64_t *r, const uint64_t *a, const uint64_t *b);
+    /* r = a * b mod 2^512, nonzero if the product does not fit; an and bn
+       are the significant lengths of a and b as for limbs_mul_comba */
+    uint64_t (*mul_low_8)(uint64_t *r, const uint64_t *a, int an, const uint64_t *b, int bn);
+    void (*sqr_8)(uint64_t *r, const uint64_t *a);
+    void (*sqr_4)(uint64_t *r, const uint64_t *a);
+    /* r = t / R mod m for a double-length t < m R; t may be overwritten */
+    void (*redc_8)(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t m_inv);
+    void (*redc_4)(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t m_inv);
+} mul_kernels_t;
+
+static void mul_8x8_portable(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    limbs_mul_comba(r, 16, a, 8, b, 8);
+}
 
-int512_error_t uint512_add_u8(const uint512_t *a, uint8_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_add(a, &temp, result);
+static void mul_4x4_portable(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    limbs_mul_comba(r, 8, a, 4, b, 4);
 }
 
-int512_error_t uint512_add_u16(const uint512_t *a, uint16_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_add(a, &temp, result);
+static uint64_t mul_low_8_portable(uint64_t *r, const uint64_t *a, int an, const uint64_t *b, int bn) {
+    return limbs_mul_comba(r, 8, a, an, b, bn);
 }
 
-int512_error_t uint512_add_u32(const uint512_t *a, uint32_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_add(a, &temp, result);
+static void sqr_8_portable(uint64_t *r, const uint64_t *a) {
+    limbs_sqr_comba(r, 16, a, 8);
 }
 
-int512_error_t uint512_add_u64(const uint512_t *a, uint64_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_add(a, &temp, result);
+static void sqr_4_portable(uint64_t *r, const uint64_t *a) {
+    limbs_sqr_comba(r, 8, a, 4);
 }
 
-int512_error_t uint512_add_u128(const uint512_t *a, const uint64_t b[2], uint512_t *result) {
-    uint512_t temp = {{b[0], b[1], 0, 0, 0, 0, 0, 0}};
-    return uint512_add(a, &temp, result);
+static void redc_8_portable(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t m_inv) {
+    mont_redc(r, t, m, m_inv, 8);
 }
 
-int512_error_t uint512_sub_u8(const uint512_t *a, uint8_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_sub(a, &temp, result);
+static void redc_4_portable(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t m_inv) {
+    mont_redc(r, t, m, m_inv, 4);
 }
 
-int512_error_t uint512_sub_u16(const uint512_t *a, uint16_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_sub(a, &temp, result);
+static const mul_kernels_t mul_kernels_portable = {
+    mul_8x8_portable, mul_4x4_portable, mul_low_8_portable,
+    sqr_8_portable, sqr_4_portable, redc_8_portable, redc_4_portable
+};
+
+#ifdef INT512_X86
+
+/*
+ * One row of a product: (t0, ..., tn) = (t0, ..., t(n-1)) + a[0..n-1] * d,
+ * where tn receives the new top limb.  Clearing tn also clears CF and OF;
+ * low product halves are added through the ADCX chain and high halves
+ * through the ADOX chain, and the final carry is folded into tn.  The
+ * limbs read from src are passed as a memory input so that stores to them
+ * are not moved past the row.
+ */
+#define MULX_STEP(i, x, y)                      \
+    "mulxq " #i "*8(%[a]), %[lo], %[hi]\n\t"    \
+    "adcxq %[lo], %[t" #x "]\n\t"               \
+    "adoxq %[hi], %[t" #y "]\n\t"
+
+#define MULX_STEPS_1 MULX_STEP(0, 0, 1)
+#define MULX_STEPS_2 MULX_STEPS_1 MULX_STEP(1, 1, 2)
+#define MULX_STEPS_3 MULX_STEPS_2 MULX_STEP(2, 2, 3)
+#define MULX_STEPS_4 MULX_STEPS_3 MULX_STEP(3, 3, 4)
+#define MULX_STEPS_5 MULX_STEPS_4 MULX_STEP(4, 4, 5)
+#define MULX_STEPS_6 MULX_STEPS_5 MULX_STEP(5, 5, 6)
+#define MULX_STEPS_7 MULX_STEPS_6 MULX_STEP(6, 6, 7)
+#define MULX_STEPS_8 MULX_STEPS_7 MULX_STEP(7, 7, 8)
+
+#define MULX_OPS_1(w0, w1) [t0] "+r"(w0), [t1] "+r"(w1)
+#define MULX_OPS_2(w0, w1, w2) MULX_OPS_1(w0, w1), [t2] "+r"(w2)
+#define MULX_OPS_3(w0, w1, w2, w3) MULX_OPS_2(w0, w1, w2), [t3] "+r"(w3)
+#define MULX_OPS_4(w0, w1, w2, w3, w4) MULX_OPS_3(w0, w1, w2, w3), [t4] "+r"(w4)
+#define MULX_OPS_5(w0, w1, w2, w3, w4, w5) MULX_OPS_4(w0, w1, w2, w3, w4), [t5] "+r"(w5)
+#define MULX_OPS_6(w0, w1, w2, w3, w4, w5, w6) MULX_OPS_5(w0, w1, w2, w3, w4, w5), [t6] "+r"(w6)
+#define MULX_OPS_7(w0, w1, w2, w3, w4, w5, w6, w7) \
+    MULX_OPS_6(w0, w1, w2, w3, w4, w5, w6), [t7] "+r"(w7)
+#define MULX_OPS_8(w0, w1, w2, w3, w4, w5, w6, w7, w8) \
+    MULX_OPS_7(w0, w1, w2, w3, w4, w5, w6, w7), [t8] "+r"(w8)
+
+#define MULX_ROW(n, src, d, ...)                                  \
+    __asm__("xorl %k[t" #n "], %k[t" #n "]\n\t"                 \
+            MULX_STEPS_##n                                      \
+            "movl $0, %k[lo]\n\t"                               \
+            "adcxq %[lo], %[t" #n "]"                           \
+            : MULX_OPS_##n(__VA_ARGS__), [lo] "=&r"(lo), [hi] "=&r"(hi) \
+            : [a] "r"(src), "m"(*(const uint64_t (*)[n])(src)), "d"(d) \
+            : "cc")
+
+/*
+ * Doubles r[0..2n-1] (the off-diagonal sum of a square) through the ADCX
+ * chain while adding the diagonal squares a[i]^2 through the ADOX chain.
+ */
+#define MULX_DIAG(i)                                                    \
+    "movq " #i "*8(%[a]), %%rdx\n\t"                                    \
+    "mulxq %%rdx, %[lo], %[hi]\n\t"                                     \
+    "movq " #i "*16(%[r]), %[x]\n\t"                                    \
+    "adcxq %[x], %[x]\n\t"                                              \
+    "adoxq %[lo], %[x]\n\t"                                             \
+    "movq %[x], " #i "*16(%[r])\n\t"                                    \
+    "movq " #i "*16+8(%[r]), %[x]\n\t"                                  \
+    "adcxq %[x], %[x]\n\t"                                              \
+    "adoxq %[hi], %[x]\n\t"                                             \
+    "movq %[x], " #i "*16+8(%[r])\n\t"
+
+/* volatile: the results are only written to memory */
+#define MULX_DIAG_ASM(steps)                                            \
+    __asm__ volatile("xorl %k[x], %k[x]\n\t" steps                      \
+                     : [lo] "=&r"(lo), [hi] "=&r"(hi), [x] "=&r"(x)     \
+                     : [a] "r"(a), [r] "r"(r)                           \
+                     : "rdx", "cc", "memory")
+
+__attribute__((target("bmi2,adx")))
+static void mul_8x8_mulx(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0;
+    uint64_t t8 = 0, t9 = 0, t10 = 0, t11 = 0, t12 = 0, t13 = 0, t14 = 0, t15 = 0;
+    uint64_t lo, hi;
+
+    MULX_ROW(8, a, b[0], t0, t1, t2, t3, t4, t5, t6, t7, t8);
+    MULX_ROW(8, a, b[1], t1, t2, t3, t4, t5, t6, t7, t8, t9);
+    MULX_ROW(8, a, b[2], t2, t3, t4, t5, t6, t7, t8, t9, t10);
+    MULX_ROW(8, a, b[3], t3, t4, t5, t6, t7, t8, t9, t10, t11);
+    MULX_ROW(8, a, b[4], t4, t5, t6, t7, t8, t9, t10, t11, t12);
+    MULX_ROW(8, a, b[5], t5, t6, t7, t8, t9, t10, t11, t12, t13);
+    MULX_ROW(8, a, b[6], t6, t7, t8, t9, t10, t11, t12, t13, t14);
+    MULX_ROW(8, a, b[7], t7, t8, t9, t10, t11, t12, t13, t14, t15);
+
+    r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3;
+    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
+    r[8] = t8; r[9] = t9; r[10] = t10; r[11] = t11;
+    r[12] = t12; r[13] = t13; r[14] = t14; r[15] = t15;
 }
 
-int512_error_t uint512_sub_u32(const uint512_t *a, uint32_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_sub(a, &temp, result);
+__attribute__((target("bmi2,adx")))
+static void mul_4x4_mulx(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0;
+    uint64_t lo, hi;
+
+    MULX_ROW(4, a, b[0], t0, t1, t2, t3, t4);
+    MULX_ROW(4, a, b[1], t1, t2, t3, t4, t5);
+    MULX_ROW(4, a, b[2], t2, t3, t4, t5, t6);
+    MULX_ROW(4, a, b[3], t3, t4, t5, t6, t7);
+
+    r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3;
+    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
 }
 
-int512_error_t uint512_sub_u64(const uint512_t *a, uint64_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_sub(a, &temp, result);
+/*
+ * Truncated product: row i adds a[0..7-i] * b[i] into columns i..7 only,
+ * with b the shorter operand so that rows past its length are skipped.
+ * The top limb of each row is what carries out of column 7; a term in
+ * column 8 or beyond exists exactly when an + bn - 1 > 8.
+ */
+__attribute__((target("bmi2,adx")))
+static uint64_t mul_low_8_mulx(uint64_t *r, const uint64_t *a, int an, const uint64_t *b, int bn) {
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0;
+    uint64_t lo, hi, top = 0, carry = an + bn > 9;
+
+    if (bn > an) {
+        const uint64_t *x = a;
+        a = b;
+        b = x;
+        bn = an;
+    }
+
+    MULX_ROW(8, a, b[0], t0, t1, t2, t3, t4, t5, t6, t7, top);
+    carry |= top;
+    if (bn > 1) {
+        MULX_ROW(7, a, b[1], t1, t2, t3, t4, t5, t6, t7, top);
+        carry |= top;
+    }
+    if (bn > 2) {
+        MULX_ROW(6, a, b[2], t2, t3, t4, t5, t6, t7, top);
+        carry |= top;
+    }
+    if (bn > 3) {
+        MULX_ROW(5, a, b[3], t3, t4, t5, t6, t7, top);
+        carry |= top;
+    }
+    if (bn > 4) {
+        MULX_ROW(4, a, b[4], t4, t5, t6, t7, top);
+        carry |= top;
+    }
+    if (bn > 5) {
+        MULX_ROW(3, a, b[5], t5, t6, t7, top);
+        carry |= top;
+    }
+    if (bn > 6) {
+        MULX_ROW(2, a, b[6], t6, t7, top);
+        carry |= top;
+    }
+    if (bn > 7) {
+        MULX_ROW(1, a, b[7], t7, top);
+        carry |= top;
+    }
+
+    r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3;
+    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
+    return carry;
 }
 
-int512_error_t uint512_sub_u128(const uint512_t *a, const uint64_t b[2], uint512_t *result) {
-    uint512_t temp = {{b[0], b[1], 0, 0, 0, 0, 0, 0}};
-    return uint512_sub(a, &temp, result);
+__attribute__((target("bmi2,adx")))
+static void sqr_8_mulx(uint64_t *r, const uint64_t *a) {
+    uint64_t t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0, t7 = 0;
+    uint64_t t8 = 0, t9 = 0, t10 = 0, t11 = 0, t12 = 0, t13 = 0, t14 = 0;
+    uint64_t lo, hi, x;
+
+    /* Off-diagonal products, row i holding a[i] * a[i+1..7] */
+    MULX_ROW(7, a + 1, a[0], t1, t2, t3, t4, t5, t6, t7, t8);
+    MULX_ROW(6, a + 2, a[1], t3, t4, t5, t6, t7, t8, t9);
+    MULX_ROW(5, a + 3, a[2], t5, t6, t7, t8, t9, t10);
+    MULX_ROW(4, a + 4, a[3], t7, t8, t9, t10, t11);
+    MULX_ROW(3, a + 5, a[4], t9, t10, t11, t12);
+    MULX_ROW(2, a + 6, a[5], t11, t12, t13);
+    MULX_ROW(1, a + 7, a[6], t13, t14);
+
+    r[0] = 0; r[1] = t1; r[2] = t2; r[3] = t3;
+    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = t7;
+    r[8] = t8; r[9] = t9; r[10] = t10; r[11] = t11;
+    r[12] = t12; r[13] = t13; r[14] = t14; r[15] = 0;
+
+    MULX_DIAG_ASM(MULX_DIAG(0) MULX_DIAG(1) MULX_DIAG(2) MULX_DIAG(3)
+                  MULX_DIAG(4) MULX_DIAG(5) MULX_DIAG(6) MULX_DIAG(7));
 }
 
-int512_error_t uint512_mul_u8(const uint512_t *a, uint8_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_mul(a, &temp, result);
+__attribute__((target("bmi2,adx")))
+static void sqr_4_mulx(uint64_t *r, const uint64_t *a) {
+    uint64_t t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, t6 = 0;
+    uint64_t lo, hi, x;
+
+    MULX_ROW(3, a + 1, a[0], t1, t2, t3, t4);
+    MULX_ROW(2, a + 2, a[1], t3, t4, t5);
+    MULX_ROW(1, a + 3, a[2], t5, t6);
+
+    r[0] = 0; r[1] = t1; r[2] = t2; r[3] = t3;
+    r[4] = t4; r[5] = t5; r[6] = t6; r[7] = 0;
+
+    MULX_DIAG_ASM(MULX_DIAG(0) MULX_DIAG(1) MULX_DIAG(2) MULX_DIAG(3));
 }
 
-int512_error_t uint512_mul_u16(const uint512_t *a, uint16_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_mul(a, &temp, result);
+/*
+ * Montgomery reduction, one MULX row per limb: row i adds q m with
+ * q = t[i] * m_inv, which clears t[i], and its top limb goes into t[i+n]
+ * through a carry chain kept outside the rows.
+ */
+__attribute__((target("bmi2,adx")))
+static void redc_8_mulx(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t m_inv) {
+    uint64_t t0 = t[0], t1 = t[1], t2 = t[2], t3 = t[3], t4 = t[4], t5 = t[5], t6 = t[6], t7 = t[7];
+    uint64_t t8 = t[8], t9 = t[9], t10 = t[10], t11 = t[11], t12 = t[12], t13 = t[13], t14 = t[14];
+    uint64_t t15 = t[15];
+    uint64_t lo, hi, top = 0, carry = 0;
+
+    MULX_ROW(8, m, t0 * m_inv, t0, t1, t2, t3, t4, t5, t6, t7, top);
+    t8 = limb_addc(t8, top, carry, &carry);
+    MULX_ROW(8, m, t1 * m_inv, t1, t2, t3, t4, t5, t6, t7, t8, top);
+    t9 = limb_addc(t9, top, carry, &carry);
+    MULX_ROW(8, m, t2 * m_inv, t2, t3, t4, t5, t6, t7, t8, t9, top);
+    t10 = limb_addc(t10, top, carry, &carry);
+    MULX_ROW(8, m, t3 * m_inv, t3, t4, t5, t6, t7, t8, t9, t10, top);
+    t11 = limb_addc(t11, top, carry, &carry);
+    MULX_ROW(8, m, t4 * m_inv, t4, t5, t6, t7, t8, t9, t10, t11, top);
+    t12 = limb_addc(t12, top, carry, &carry);
+    MULX_ROW(8, m, t5 * m_inv, t5, t6, t7, t8, t9, t10, t11, t12, top);
+    t13 = limb_addc(t13, top, carry, &carry);
+    MULX_ROW(8, m, t6 * m_inv, t6, t7, t8, t9, t10, t11, t12, t13, top);
+    t14 = limb_addc(t14, top, carry, &carry);
+    MULX_ROW(8, m, t7 * m_inv, t7, t8, t9, t10, t11, t12, t13, t14, top);
+    t15 = limb_addc(t15, top, carry, &carry);
+
+    uint64_t u[8] = {t8, t9, t10, t11, t12, t13, t14, t15};
+    mont_reduce_once(r, u, carry, m, 8);
 }
 
-int512_error_t uint512_mul_u32(const uint512_t *a, uint32_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_mul(a, &temp, result);
+__attribute__((target("bmi2,adx")))
+static void redc_4_mulx(uint64_t *r, uint64_t *t, const uint64_t *m, uint64_t m_inv) {
+    uint64_t t0 = t[0], t1 = t[1], t2 = t[2], t3 = t[3], t4 = t[4], t5 = t[5], t6 = t[6], t7 = t[7];
+    uint64_t lo, hi, top = 0, carry = 0;
+
+    MULX_ROW(4, m, t0 * m_inv, t0, t1, t2, t3, top);
+    t4 = limb_addc(t4, top, carry, &carry);
+    MULX_ROW(4, m, t1 * m_inv, t1, t2, t3, t4, top);
+    t5 = limb_addc(t5, top, carry, &carry);
+    MULX_ROW(4, m, t2 * m_inv, t2, t3, t4, t5, top);
+    t6 = limb_addc(t6, top, carry, &carry);
+    MULX_ROW(4, m, t3 * m_inv, t3, t4, t5, t6, top);
+    t7 = limb_addc(t7, top, carry, &carry);
+
+    uint64_t u[4] = {t4, t5, t6, t7};
+    mont_reduce_once(r, u, carry, m, 4);
 }
 
-int512_error_t uint512_mul_u64(const uint512_t *a, uint64_t b, uint512_t *result) {
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    return uint512_mul(a, &temp, result);
+static const mul_kernels_t mul_kernels_mulx = {
+    mul_8x8_mulx, mul_4x4_mulx, mul_low_8_mulx,
+    sqr_8_mulx, sqr_4_mulx, redc_8_mulx, redc_4_mulx
+};
+
+static bool cpu_has_mulx(void) {
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+    return (ebx & bit_BMI2) && (ebx & bit_ADX);
 }
 
-int512_error_t uint512_mul_u128(const uint512_t *a, const uint64_t b[2], uint512_t *result) {
-    uint512_t temp = {{b[0], b[1], 0, 0, 0, 0, 0, 0}};
-    return uint512_mul(a, &temp, result);
+#else
+
+static bool cpu_has_mulx(void) {
+    return false;
 }
 
-int512_error_t uint512_div_u8(const uint512_t *a, uint8_t b, uint512_t *quotient, uint8_t *remainder) {
-    if (!remainder) return INT512_ERR_NULL_POINTER;
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    uint512_t rem512;
-    int512_error_t err = uint512_div(a, &temp, quotient, &rem512);
-    if (err == INT512_OK) {
-        *remainder = (uint8_t)rem512.words[0];
-    }
-    return err;
+#endif /* INT512_X86 */
+
+static const mul_kernels_t *mul_kernels = &mul_kernels_portable;
+
+__attribute__((constructor))
+static void mul_kernels_init(void) {
+    int512_set_kernel(INT512_KERNEL_AUTO);
 }
 
-int512_error_t uint512_div_u16(const uint512_t *a, uint16_t b, uint512_t *quotient, uint16_t *remainder) {
-    if (!remainder) return INT512_ERR_NULL_POINTER;
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    uint512_t rem512;
-    int512_error_t err = uint512_div(a, &temp, quotient, &rem512);
-    if (err == INT512_OK) {
-        *remainder = (uint16_t)rem512.words[0];
+int512_error_t int512_set_kernel(int512_kernel_t kernel) {
+    switch (kernel) {
+    case INT512_KERNEL_AUTO:
+#ifdef INT512_X86
+        mul_kernels = cpu_has_mulx() ? &mul_kernels_mulx : &mul_kernels_portable;
+#else
+        mul_kernels = &mul_kernels_portable;
+#endif
+        return INT512_OK;
+    case INT512_KERNEL_PORTABLE:
+        mul_kernels = &mul_kernels_portable;
+        return INT512_OK;
+    case INT512_KERNEL_MULX:
+        if (!cpu_has_mulx()) return INT512_ERR_UNSUPPORTED;
+#ifdef INT512_X86
+        mul_kernels = &mul_kernels_mulx;
+#endif
+        return INT512_OK;
     }
-    return err;
+    return INT512_ERR_UNSUPPORTED;
 }
 
-int512_error_t uint512_div_u32(const uint512_t *a, uint32_t b, uint512_t *quotient, uint32_t *remainder) {
-    if (!remainder) return INT512_ERR_NULL_POINTER;
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    uint512_t rem512;
-    int512_error_t err = uint512_div(a, &temp, quotient, &rem512);
-    if (err == INT512_OK) {
-        *remainder = (uint32_t)rem512.words[0];
-    }
-    return err;
+int512_kernel_t int512_get_kernel(void) {
+#ifdef INT512_X86
+    if (mul_kernels == &mul_kernels_mulx) return INT512_KERNEL_MULX;
+#endif
+    return INT512_KERNEL_PORTABLE;
 }
 
-int512_error_t uint512_div_u64(const uint512_t *a, uint64_t b, uint512_t *quotient, uint64_t *remainder) {
-    if (!remainder) return INT512_ERR_NULL_POINTER;
-    uint512_t temp = {{b, 0, 0, 0, 0, 0, 0, 0}};
-    uint512_t rem512;
-    int512_error_t err = uint512_div(a, &temp, quotient, &rem512);
-    if (err == INT512_OK) {
-        *remainder = rem512.words[0];
+/*
+ * Products for the wide types.  Operand lengths are whole 8-limb tiles.
+ * Below the Karatsuba threshold the product is a schoolbook grid of mul_8x8
+ * tiles on the selected kernel; at or above it, an operand pair whose
+ * halves are whole tiles is split once and the three half-size products
+ * recurse.  The default threshold is the crossover measured by
+ * bench_int512.
+ */
+#define WIDE_LIMBS_MAX 64
+#define KARATSUBA_THRESHOLD_DEFAULT 32
+
+static int karatsuba_threshold = KARATSUBA_THRESHOLD_DEFAULT;
+
+/* r[0..an+bn-1] = a * b by 8x8 tiles.  r must not overlap a or b. */
+static void limbs_mul_tiles(uint64_t *r, const uint64_t *a, int an, const uint64_t *b, int bn) {
+    uint64_t t[16];
+
+    memset(r, 0, (size_t)(an + bn) * sizeof(uint64_t));
+    for (int i = 0; i < an; i += 8) {
+        for (int j = 0; j < bn; j += 8) {
+            mul_kernels->mul_8x8(t, a + i, b + j);
+            uint64_t carry = limbs_add_n(r + i + j, r + i + j, t, 16);
+            limbs_incr(r + i + j + 16, an + bn - i - j - 16, carry);
+        }
     }
-    return err;
 }
 
-int512_error_t uint512_div_u128(const uint512_t *a, const uint64_t b[2], uint512_t *quotient, uint64_t remainder[2]) {
-    if (!remainder) return INT512_ERR_NULL_POINTER;
-    uint512_t temp = {{b[0], b[1], 0, 0, 0, 0, 0, 0}};
-    uint512_t rem512;
-    int512_error_t err = uint512_div(a, &temp, quotient, &rem512);
-    if (err == INT512_OK) {
-        remainder[0] = rem512.words[0];
-        remainder[1] = rem512.words[1];
+/* r = |a - b| over n limbs; returns true when a < b */
+static bool limbs_absdiff(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    if (limbs_cmp(a, b, n) < 0) {
+        limbs_sub_n(r, b, a, n);
+        return true;
     }
-    return err;
+    limbs_sub_n(r, a, b, n);
+    return false;
+}
+
+/*
+ * r[0..2n-1] = a * b for two n-limb operands.  With a = a0 + a1 B^h and
+ * b = b0 + b1 B^h, the middle term a0 b1 + a1 b0 is z0 + z2 - (a0 - a1)(b0 - b1)
+ * where z0 = a0 b0 and z2 = a1 b1; the subtractive form keeps every partial
+ * product at h limbs.
+ */
+static void limbs_mul_karatsuba(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    if (n < karatsuba_threshold || n % 16 != 0) {
+        limbs_mul_tiles(r, a, n, b, n);
+        return;
+    }
+
+    int h = n / 2;
+    uint64_t da[WIDE_LIMBS_MAX / 2], db[WIDE_LIMBS_MAX / 2];
+    uint64_t t[WIDE_LIMBS_MAX], u[WIDE_LIMBS_MAX + 1];
+
+    bool negative = limbs_absdiff(da, a, a + h, h) != limbs_absdiff(db, b, b + h, h);
+    limbs_mul_karatsuba(r, a, b, h);
+    limbs_mul_karatsuba(r + n, a + h, b + h, h);
+    limbs_mul_karatsuba(t, da, db, h);
+
+    /* u = z0 + z2 -/+ |(a0 - a1)(b0 - b1)|, never negative */
+    u[n] = limbs_add_n(u, r, r + n, n);
+    if (negative) {
+        u[n] += limbs_add_n(u, u, t, n);
+    } else {
+        u[n] -= limbs_sub_n(u, u, t, n);
+    }
+
+    uint64_t carry = limbs_add_n(r + h, r + h, u, n + 1);
+    limbs_incr(r + h + n + 1, n - h - 1, carry);
+}
+
+/*
+ * r[0..an+bn-1] = a * b with an >= bn.  Unbalanced operands are cut into
+ * bn-limb slices of a so that each slice product can still use Karatsuba.
+ */
+static void limbs_mul_wide(uint64_t *r, const uint64_t *a, int an, const uint64_t *b, int bn) {
+    if (bn < karatsuba_threshold) {
+        limbs_mul_tiles(r, a, an, b, bn);
+        return;
+    }
+    if (an == bn) {
+        limbs_mul_karatsuba(r, a, b, an);
+        return;
+    }
+
+    uint64_t t[2 * WIDE_LIMBS_MAX];
+
+    limbs_mul_karatsuba(r, a, b, bn);
+    memset(r + 2 * bn, 0, (size_t)(an - bn) * sizeof(uint64_t));
+    for (int off = bn; off < an; off += bn) {
+        int len = an - off < bn ? an - off : bn;
+        limbs_mul_wide(t, b, bn, a + off, len);
+        uint64_t carry = limbs_add_n(r + off, r + off, t, bn + len);
+        limbs_incr(r + off + bn + len, an - off - len, carry);
+    }
+}
+
+void int512_set_karatsuba_threshold(int limbs) {
+    karatsuba_threshold = limbs > 0 ? limbs : KARATSUBA_THRESHOLD_DEFAULT;
+}
+
+int int512_get_karatsuba_threshold(void) {
+    return karatsuba_threshold;
 }
 
 /* ============================================================================
- * Mixed-size Signed Operations
+ * Unsigned Arithmetic Operations
  * ============================================================================ */
 
-int512_error_t int512_add_i8(const int512_t *a, int8_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
+int512_error_t uint512_add(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t carry = limbs_add_8(result->words, a->words, b->words);
+
+    return carry ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint512_sub(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t borrow = limbs_sub_8(result->words, a->words, b->words);
+
+    return borrow ? INT512_ERR_UNDERFLOW : INT512_OK;
+}
+
+/* r = a * b mod 2^512 over 8 limbs; returns nonzero when the product does
+   not fit.  r may alias a or b. */
+static uint64_t limbs_mul_low_8(uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    /* Only the columns below limb 8 are computed; whatever lies above them
+       is detected from the operand lengths and the final carry */
+    int ma = limbs_count(a, 8);
+    int mb = limbs_count(b, 8);
+    uint64_t temp[8];
+    uint64_t overflow;
+    if (ma <= 4 && mb <= 4) {
+        mul_kernels->mul_4x4(temp, a, b);
+        overflow = 0;
     } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+        overflow = mul_kernels->mul_low_8(temp, a, ma, b, mb);
     }
-    return int512_add(a, &temp, result);
+
+    memcpy(r, temp, sizeof(temp));
+    return overflow;
 }
 
-int512_error_t int512_add_i16(const int512_t *a, int16_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
+int512_error_t uint512_mul(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    if (a == b) return uint512_sqr(a, result);
+
+    uint64_t overflow = limbs_mul_low_8(result->words, a->words, b->words);
+    return overflow ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint512_mul_wide(const uint512_t *a, const uint512_t *b, uint1024_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    if (a == b) return uint512_sqr_wide(a, result);
+
+    uint1024_t temp;
+    if (limbs_count(a->words, 8) <= 4 && limbs_count(b->words, 8) <= 4) {
+        mul_kernels->mul_4x4(temp.words, a->words, b->words);
+        memset(temp.words + 8, 0, 8 * sizeof(uint64_t));
     } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+        mul_kernels->mul_8x8(temp.words, a->words, b->words);
     }
-    return int512_add(a, &temp, result);
+
+    *result = temp;
+    return INT512_OK;
 }
 
-int512_error_t int512_add_i32(const int512_t *a, int32_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+int512_error_t uint512_sqr(const uint512_t *a, uint512_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+
+    /* A square of more than four limbs always overflows, but the low half
+       of the full product is still the result */
+    if (limbs_count(a->words, 8) <= 4) {
+        uint512_t temp;
+        mul_kernels->sqr_4(temp.words, a->words);
+        *result = temp;
+        return INT512_OK;
     }
-    return int512_add(a, &temp, result);
+
+    uint1024_t wide;
+    mul_kernels->sqr_8(wide.words, a->words);
+    memcpy(result->words, wide.words, sizeof(result->words));
+    return INT512_ERR_OVERFLOW;
 }
 
-int512_error_t int512_add_i64(const int512_t *a, int64_t b, int512_t *result) {
-    int512_t temp;
-    if (b < 0) {
-        temp = (int512_t){{(uint64_t)b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
+int512_error_t uint512_sqr_wide(const uint512_t *a, uint1024_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+
+    uint1024_t temp;
+    if (limbs_count(a->words, 8) <= 4) {
+        mul_kernels->sqr_4(temp.words, a->words);
+        memset(temp.words + 8, 0, 8 * sizeof(uint64_t));
     } else {
-        temp = (int512_t){{(uint64_t)b, 0, 0, 0, 0, 0, 0, 0}};
+        mul_kernels->sqr_8(temp.words, a->words);
     }
-    return int512_add(a, &temp, result);
+
+    *result = temp;
+    return INT512_OK;
 }
 
-int512_error_t int512_add_i128(const int512_t *a, const int64_t b[2], int512_t *result) {
-    int512_t temp;
-    if (b[1] < 0) {
-        temp = (int512_t){{(uint64_t)b[0], (uint64_t)b[1], UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
+int512_error_t uint512_mul_high(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint1024_t wide;
+    uint512_mul_wide(a, b, &wide);
+
+    memcpy(result->words, wide.words + 8, sizeof(result->words));
+    return INT512_OK;
+}
+
+int512_error_t uint512_div(const uint512_t *a, const uint512_t *b, uint512_t *quotient, uint512_t *remainder) {
+    if (!a || !b || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
+
+    int n = limbs_count(b->words, 8);
+    if (n == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    int m = limbs_count(a->words, 8);
+    uint512_t q = UINT512_ZERO;
+    uint512_t r = UINT512_ZERO;
+
+    if (uint512_compare(a, b) < 0) {
+        r = *a;
+    } else if (n == 1) {
+        r.words[0] = limbs_divrem_1(q.words, a->words, m, b->words[0]);
     } else {
-        temp = (int512_t){{(uint64_t)b[0], (uint64_t)b[1], 0, 0, 0, 0, 0, 0}};
+        limbs_divmod(q.words, r.words, a->words, m, b->words, n);
     }
-    return int512_add(a, &temp, result);
+
+    *quotient = q;
+    *remainder = r;
+    return INT512_OK;
 }
 
-int512_error_t int512_sub_i8(const int512_t *a, int8_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+/* ============================================================================
+ * Signed Arithmetic Operations
+ * ============================================================================ */
+
+static void int512_negate(int512_t *a) {
+    /* Two's complement: flip bits and add 1 */
+    for (int i = 0; i < 8; i++) {
+        a->words[i] = ~a->words[i];
+    }
+    uint64_t carry = 1;
+    for (int i = 0; i < 8; i++) {
+        uint64_t sum = a->words[i] + carry;
+        carry = (sum < a->words[i]) ? 1 : 0;
+        a->words[i] = sum;
     }
-    return int512_sub(a, &temp, result);
 }
 
-int512_error_t int512_sub_i16(const int512_t *a, int16_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+int512_error_t int512_add(const int512_t *a, const int512_t *b, int512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t a_top = a->words[7];
+    uint64_t b_top = b->words[7];
+    uint64_t carry = limbs_add_8(result->words, a->words, b->words);
+
+    /* Signed overflow: the carry into the sign bit differs from the carry
+       out of it */
+    uint64_t sign_carry = (a_top ^ b_top ^ result->words[7]) >> 63;
+    if (carry ^ sign_carry) {
+        return (a_top >> 63) ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
     }
-    return int512_sub(a, &temp, result);
+
+    return INT512_OK;
 }
 
-int512_error_t int512_sub_i32(const int512_t *a, int32_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+int512_error_t int512_sub(const int512_t *a, const int512_t *b, int512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t a_top = a->words[7];
+    uint64_t b_top = b->words[7];
+    uint64_t borrow = limbs_sub_8(result->words, a->words, b->words);
+
+    /* Signed overflow: the borrow into the sign bit differs from the borrow
+       out of it */
+    uint64_t sign_borrow = (a_top ^ b_top ^ result->words[7]) >> 63;
+    if (borrow ^ sign_borrow) {
+        return (a_top >> 63) ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
+    }
+
+    return INT512_OK;
+}
+
+int512_error_t int512_mul(const int512_t *a, const int512_t *b, int512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    if (a == b) return int512_sqr(a, result);
+
+    int512_t abs_a = *a;
+    int512_t abs_b = *b;
+    bool negate_result = false;
+
+    if (int512_is_negative(a)) {
+        int512_negate(&abs_a);
+        negate_result = !negate_result;
+    }
+    if (int512_is_negative(b)) {
+        int512_negate(&abs_b);
+        negate_result = !negate_result;
+    }
+
+    int512_error_t err = uint512_mul((const uint512_t *)&abs_a, (const uint512_t *)&abs_b, (uint512_t *)result);
+
+    if (negate_result) {
+        int512_negate(result);
     }
-    return int512_sub(a, &temp, result);
+
+    /* Check for overflow */
+    if (err == INT512_ERR_OVERFLOW) return INT512_ERR_OVERFLOW;
+    if (!negate_result && int512_is_negative(result)) return INT512_ERR_OVERFLOW;
+    if (negate_result && !int512_is_negative(result) && !int512_is_zero(result)) return INT512_ERR_OVERFLOW;
+
+    return INT512_OK;
 }
 
-int512_error_t int512_sub_i64(const int512_t *a, int64_t b, int512_t *result) {
-    int512_t temp;
-    if (b < 0) {
-        temp = (int512_t){{(uint64_t)b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)b, 0, 0, 0, 0, 0, 0, 0}};
+int512_error_t int512_sqr(const int512_t *a, int512_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+
+    int512_t abs_a = *a;
+    if (int512_is_negative(a)) {
+        int512_negate(&abs_a);
     }
-    return int512_sub(a, &temp, result);
+
+    int512_error_t err = uint512_sqr((const uint512_t *)&abs_a, (uint512_t *)result);
+    if (err == INT512_ERR_OVERFLOW) return INT512_ERR_OVERFLOW;
+    if (int512_is_negative(result)) return INT512_ERR_OVERFLOW;
+
+    return INT512_OK;
 }
 
-int512_error_t int512_sub_i128(const int512_t *a, const int64_t b[2], int512_t *result) {
-    int512_t temp;
-    if (b[1] < 0) {
-        temp = (int512_t){{(uint64_t)b[0], (uint64_t)b[1], UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)b[0], (uint64_t)b[1], 0, 0, 0, 0, 0, 0}};
+int512_error_t int512_div(const int512_t *a, const int512_t *b, int512_t *quotient, int512_t *remainder) {
+    if (!a || !b || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
+    if (int512_is_zero(b)) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    int512_t abs_a = *a;
+    int512_t abs_b = *b;
+    bool negate_quotient = false;
+    bool negate_remainder = false;
+
+    if (int512_is_negative(a)) {
+        int512_negate(&abs_a);
+        negate_quotient = !negate_quotient;
+        negate_remainder = true;
+    }
+    if (int512_is_negative(b)) {
+        int512_negate(&abs_b);
+        negate_quotient = !negate_quotient;
+    }
+
+    int512_error_t err = uint512_div((const uint512_t *)&abs_a, (const uint512_t *)&abs_b,
+                                     (uint512_t *)quotient, (uint512_t *)remainder);
+
+    if (err != INT512_OK) return err;
+
+    if (negate_quotient) {
+        int512_negate(quotient);
+    }
+    if (negate_remainder) {
+        int512_negate(remainder);
     }
-    return int512_sub(a, &temp, result);
+
+    return INT512_OK;
 }
 
-int512_error_t int512_mul_i8(const int512_t *a, int8_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+/* ============================================================================
+ * Bit Operations
+ * ============================================================================
+ *
+ * Shifts move whole limbs and funnel the remaining bits across limb
+ * boundaries with limbs_lshift/limbs_rshift, so their cost does not grow
+ * with the shift count.
+ */
+
+int512_error_t uint512_shl(const uint512_t *a, unsigned int shift, uint512_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+    if (shift >= 512) {
+        *result = UINT512_ZERO;
+        return INT512_OK;
     }
-    return int512_mul(a, &temp, result);
+
+    int limbs = (int)(shift / 64);
+    limbs_lshift(result->words + limbs, a->words, 8 - limbs, (int)(shift % 64));
+    memset(result->words, 0, (size_t)limbs * sizeof(uint64_t));
+    return INT512_OK;
 }
 
-int512_error_t int512_mul_i16(const int512_t *a, int16_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+int512_error_t uint512_shr(const uint512_t *a, unsigned int shift, uint512_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+    if (shift >= 512) {
+        *result = UINT512_ZERO;
+        return INT512_OK;
     }
-    return int512_mul(a, &temp, result);
+
+    int limbs = (int)(shift / 64);
+    limbs_rshift(result->words, a->words + limbs, 8 - limbs, (int)(shift % 64));
+    memset(result->words + 8 - limbs, 0, (size_t)limbs * sizeof(uint64_t));
+    return INT512_OK;
 }
 
-int512_error_t int512_mul_i32(const int512_t *a, int32_t b, int512_t *result) {
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
+int512_error_t int512_sar(const int512_t *a, unsigned int shift, int512_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t fill = int512_is_negative(a) ? UINT64_MAX : 0;
+    if (shift >= 512) {
+        memset(result->words, (int)(fill & 0xff), sizeof(result->words));
+        return INT512_OK;
+    }
+
+    int limbs = (int)(shift / 64);
+    int bits = (int)(shift % 64);
+    limbs_rshift(result->words, a->words + limbs, 8 - limbs, bits);
+    if (bits != 0) {
+        result->words[7 - limbs] |= fill << (64 - bits);
+    }
+    for (int i = 8 - limbs; i < 8; i++) {
+        result->words[i] = fill;
     }
-    return int512_mul(a, &temp, result);
+    return INT512_OK;
 }
 
-int512_error_t int512_mul_i64(const int512_t *a, int64_t b, int512_t *result) {
-    int512_t temp;
-    if (b < 0) {
-        temp = (int512_t){{(uint64_t)b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)b, 0, 0, 0, 0, 0, 0, 0}};
+int512_error_t uint512_and(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    for (int i = 0; i < 8; i++) {
+        result->words[i] = a->words[i] & b->words[i];
+    }
+    return INT512_OK;
+}
+
+int512_error_t uint512_or(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    for (int i = 0; i < 8; i++) {
+        result->words[i] = a->words[i] | b->words[i];
+    }
+    return INT512_OK;
+}
+
+int512_error_t uint512_xor(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    for (int i = 0; i < 8; i++) {
+        result->words[i] = a->words[i] ^ b->words[i];
+    }
+    return INT512_OK;
+}
+
+int512_error_t uint512_not(const uint512_t *a, uint512_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+
+    for (int i = 0; i < 8; i++) {
+        result->words[i] = ~a->words[i];
+    }
+    return INT512_OK;
+}
+
+int uint512_bit_length(const uint512_t *a) {
+    if (!a) return 0;
+    return limbs_bit_length(a->words, 8);
+}
+
+int uint512_ctz(const uint512_t *a) {
+    if (!a) return 0;
+    for (int i = 0; i < 8; i++) {
+        if (a->words[i] != 0) return 64 * i + limb_ctz(a->words[i]);
+    }
+    return 512;
+}
+
+int uint512_popcount(const uint512_t *a) {
+    if (!a) return 0;
+    int count = 0;
+    for (int i = 0; i < 8; i++) {
+        count += __builtin_popcountll(a->words[i]);
+    }
+    return count;
+}
+
+bool uint512_test_bit(const uint512_t *a, unsigned int bit) {
+    if (!a || bit >= 512) return false;
+    return limbs_bit(a->words, (int)bit);
+}
+
+int512_error_t uint512_set_bit(uint512_t *a, unsigned int bit) {
+    if (!a) return INT512_ERR_NULL_POINTER;
+    if (bit >= 512) return INT512_ERR_OVERFLOW;
+
+    a->words[bit / 64] |= (uint64_t)1 << (bit % 64);
+    return INT512_OK;
+}
+
+int512_error_t uint512_clear_bit(uint512_t *a, unsigned int bit) {
+    if (!a) return INT512_ERR_NULL_POINTER;
+    if (bit >= 512) return INT512_ERR_OVERFLOW;
+
+    a->words[bit / 64] &= ~((uint64_t)1 << (bit % 64));
+    return INT512_OK;
+}
+
+/* ============================================================================
+ * Wide Unsigned Arithmetic
+ * ============================================================================ */
+
+/* Significant length of an n-limb operand rounded up to whole tiles; from
+   the Karatsuba threshold up, to tile pairs so that it can be halved */
+static int wide_length(const uint64_t *w, int n) {
+    int m = limbs_count(w, n);
+    int unit = m >= karatsuba_threshold ? 16 : 8;
+    m = (m + unit - 1) & ~(unit - 1);
+    return m < n ? m : n;
+}
+
+/* r[0..2n-1] = a * b for two n-limb operands; r must not overlap them */
+static void wide_mul(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    int ma = wide_length(a, n);
+    int mb = wide_length(b, n);
+
+    if (ma == 0 || mb == 0) {
+        memset(r, 0, (size_t)(2 * n) * sizeof(uint64_t));
+        return;
+    }
+    if (ma < mb) {
+        const uint64_t *tp = a; a = b; b = tp;
+        int tn = ma; ma = mb; mb = tn;
+    }
+    limbs_mul_wide(r, a, ma, b, mb);
+    memset(r + ma + mb, 0, (size_t)(2 * n - ma - mb) * sizeof(uint64_t));
+}
+
+static int512_error_t wide_mul_low(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    uint64_t t[2 * WIDE_LIMBS_MAX];
+
+    wide_mul(t, a, b, n);
+    memcpy(r, t, (size_t)n * sizeof(uint64_t));
+
+    return limbs_count(t + n, n) ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint1024_add(const uint1024_t *a, const uint1024_t *b, uint1024_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return limbs_add_n(result->words, a->words, b->words, 16) ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint1024_sub(const uint1024_t *a, const uint1024_t *b, uint1024_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return limbs_sub_n(result->words, a->words, b->words, 16) ? INT512_ERR_UNDERFLOW : INT512_OK;
+}
+
+int512_error_t uint1024_mul(const uint1024_t *a, const uint1024_t *b, uint1024_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return wide_mul_low(result->words, a->words, b->words, 16);
+}
+
+int512_error_t uint1024_mul_wide(const uint1024_t *a, const uint1024_t *b, uint2048_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    uint64_t t[32];
+    wide_mul(t, a->words, b->words, 16);
+    memcpy(result->words, t, sizeof(t));
+    return INT512_OK;
+}
+
+int uint1024_compare(const uint1024_t *a, const uint1024_t *b) {
+    if (!a || !b) return 0;
+    return limbs_cmp(a->words, b->words, 16);
+}
+
+int512_error_t uint2048_add(const uint2048_t *a, const uint2048_t *b, uint2048_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return limbs_add_n(result->words, a->words, b->words, 32) ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint2048_sub(const uint2048_t *a, const uint2048_t *b, uint2048_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return limbs_sub_n(result->words, a->words, b->words, 32) ? INT512_ERR_UNDERFLOW : INT512_OK;
+}
+
+int512_error_t uint2048_mul(const uint2048_t *a, const uint2048_t *b, uint2048_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return wide_mul_low(result->words, a->words, b->words, 32);
+}
+
+int512_error_t uint2048_mul_wide(const uint2048_t *a, const uint2048_t *b, uint4096_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    uint64_t t[64];
+    wide_mul(t, a->words, b->words, 32);
+    memcpy(result->words, t, sizeof(t));
+    return INT512_OK;
+}
+
+int uint2048_compare(const uint2048_t *a, const uint2048_t *b) {
+    if (!a || !b) return 0;
+    return limbs_cmp(a->words, b->words, 32);
+}
+
+int512_error_t uint4096_add(const uint4096_t *a, const uint4096_t *b, uint4096_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return limbs_add_n(result->words, a->words, b->words, 64) ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint4096_sub(const uint4096_t *a, const uint4096_t *b, uint4096_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return limbs_sub_n(result->words, a->words, b->words, 64) ? INT512_ERR_UNDERFLOW : INT512_OK;
+}
+
+int512_error_t uint4096_mul(const uint4096_t *a, const uint4096_t *b, uint4096_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+    return wide_mul_low(result->words, a->words, b->words, 64);
+}
+
+int uint4096_compare(const uint4096_t *a, const uint4096_t *b) {
+    if (!a || !b) return 0;
+    return limbs_cmp(a->words, b->words, 64);
+}
+
+/* ============================================================================
+ * Mixed-size Unsigned Operations
+ * ============================================================================ */
+
+/*
+ * The mixed-size forms work on the narrow operand directly: add and sub stop
+ * propagating once the carry dies, and mul makes one pass over a per limb
+ * of b instead of running the full 8x8 product.
+ */
+static int512_error_t uint512_add_small(const uint512_t *a, const uint64_t *b, int bn, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t carry = limbs_add_ext(result->words, a->words, b, bn, 0);
+
+    return carry ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+static int512_error_t uint512_sub_small(const uint512_t *a, const uint64_t *b, int bn, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t borrow = limbs_sub_ext(result->words, a->words, b, bn, 0);
+
+    return borrow ? INT512_ERR_UNDERFLOW : INT512_OK;
+}
+
+static int512_error_t uint512_mul_small(const uint512_t *a, const uint64_t *b, int bn, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t over = limbs_mul_small(result->words, a->words, b, bn);
+
+    return over ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint512_add_u8(const uint512_t *a, uint8_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_add_u16(const uint512_t *a, uint16_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_add_u32(const uint512_t *a, uint32_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_add_u64(const uint512_t *a, uint64_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_add_u128(const uint512_t *a, const uint64_t b[2], uint512_t *result) {
+    return uint512_add_small(a, b, 2, result);
+}
+
+int512_error_t uint512_sub_u8(const uint512_t *a, uint8_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_sub_u16(const uint512_t *a, uint16_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_sub_u32(const uint512_t *a, uint32_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_sub_u64(const uint512_t *a, uint64_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_sub_u128(const uint512_t *a, const uint64_t b[2], uint512_t *result) {
+    return uint512_sub_small(a, b, 2, result);
+}
+
+int512_error_t uint512_mul_u8(const uint512_t *a, uint8_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_mul_u16(const uint512_t *a, uint16_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_mul_u32(const uint512_t *a, uint32_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_mul_u64(const uint512_t *a, uint64_t b, uint512_t *result) {
+    uint64_t limb = b;
+    return uint512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t uint512_mul_u128(const uint512_t *a, const uint64_t b[2], uint512_t *result) {
+    return uint512_mul_small(a, b, 2, result);
+}
+
+int512_error_t uint512_div_u8(const uint512_t *a, uint8_t b, uint512_t *quotient, uint8_t *remainder) {
+    if (!remainder) return INT512_ERR_NULL_POINTER;
+    uint64_t rem64;
+    int512_error_t err = uint512_div_u64(a, b, quotient, &rem64);
+    if (err == INT512_OK) {
+        *remainder = (uint8_t)rem64;
+    }
+    return err;
+}
+
+int512_error_t uint512_div_u16(const uint512_t *a, uint16_t b, uint512_t *quotient, uint16_t *remainder) {
+    if (!remainder) return INT512_ERR_NULL_POINTER;
+    uint64_t rem64;
+    int512_error_t err = uint512_div_u64(a, b, quotient, &rem64);
+    if (err == INT512_OK) {
+        *remainder = (uint16_t)rem64;
+    }
+    return err;
+}
+
+int512_error_t uint512_div_u32(const uint512_t *a, uint32_t b, uint512_t *quotient, uint32_t *remainder) {
+    if (!remainder) return INT512_ERR_NULL_POINTER;
+    uint64_t rem64;
+    int512_error_t err = uint512_div_u64(a, b, quotient, &rem64);
+    if (err == INT512_OK) {
+        *remainder = (uint32_t)rem64;
+    }
+    return err;
+}
+
+int512_error_t uint512_div_u64(const uint512_t *a, uint64_t b, uint512_t *quotient, uint64_t *remainder) {
+    if (!a || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
+    if (b == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    int m = limbs_count(a->words, 8);
+    *remainder = limbs_divrem_1(quotient->words, a->words, m, b);
+    for (int i = m; i < 8; i++) quotient->words[i] = 0;
+    return INT512_OK;
+}
+
+int512_error_t uint512_div_u128(const uint512_t *a, const uint64_t b[2], uint512_t *quotient, uint64_t remainder[2]) {
+    if (!remainder) return INT512_ERR_NULL_POINTER;
+    uint512_t temp = {{b[0], b[1], 0, 0, 0, 0, 0, 0}};
+    uint512_t rem512;
+    int512_error_t err = uint512_div(a, &temp, quotient, &rem512);
+    if (err == INT512_OK) {
+        remainder[0] = rem512.words[0];
+        remainder[1] = rem512.words[1];
+    }
+    return err;
+}
+
+/* ============================================================================
+ * Precomputed Single-limb Divisors
+ * ============================================================================ */
+
+int512_error_t uint512_divisor_u64_init(uint512_divisor_u64_t *divisor, uint64_t d) {
+    if (!divisor) return INT512_ERR_NULL_POINTER;
+    if (d == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    divisor->shift = limb_clz(d);
+    divisor->normalized = d << divisor->shift;
+    divisor->reciprocal = limb_reciprocal(divisor->normalized);
+    return INT512_OK;
+}
+
+int512_error_t uint512_div_u64_by(const uint512_t *a, const uint512_divisor_u64_t *divisor,
+                                  uint512_t *quotient, uint64_t *remainder) {
+    if (!a || !divisor || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
+    if (divisor->normalized == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    int m = limbs_count(a->words, 8);
+    *remainder = limbs_divrem_1_preinv(quotient->words, a->words, m, divisor->normalized,
+                                       divisor->reciprocal, divisor->shift);
+    for (int i = m; i < 8; i++) quotient->words[i] = 0;
+    return INT512_OK;
+}
+
+/* ============================================================================
+ * Precomputed Divisors
+ * ============================================================================ */
+
+int512_error_t uint512_divisor_init(uint512_divisor_t *divisor, const uint512_t *d) {
+    if (!divisor || !d) return INT512_ERR_NULL_POINTER;
+
+    int n = limbs_count(d->words, 8);
+    if (n == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    memset(divisor, 0, sizeof(*divisor));
+    divisor->limbs = n;
+    divisor->shift = limb_clz(d->words[n - 1]);
+    limbs_lshift(divisor->normalized, d->words, n, divisor->shift);
+    divisor->reciprocal = limb_reciprocal(divisor->normalized[n - 1]);
+    divisor->negative = false;
+    return INT512_OK;
+}
+
+int512_error_t int512_divisor_init(uint512_divisor_t *divisor, const int512_t *d) {
+    if (!divisor || !d) return INT512_ERR_NULL_POINTER;
+
+    int512_t abs_d = *d;
+    bool negative = int512_is_negative(d);
+    if (negative) {
+        int512_negate(&abs_d);
+    }
+
+    int512_error_t err = uint512_divisor_init(divisor, (const uint512_t *)&abs_d);
+    if (err != INT512_OK) return err;
+
+    divisor->negative = negative;
+    return INT512_OK;
+}
+
+/* Divides a by the magnitude of a prepared divisor; q may be NULL */
+static void uint512_divmod_by(const uint512_t *a, const uint512_divisor_t *divisor, uint512_t *q, uint512_t *r) {
+    int n = divisor->limbs;
+    int m = limbs_count(a->words, 8);
+    uint512_t quot = UINT512_ZERO;
+    uint512_t rem = UINT512_ZERO;
+
+    if (m < n) {
+        rem = *a;
+    } else if (n == 1) {
+        rem.words[0] = limbs_divrem_1_preinv(quot.words, a->words, m, divisor->normalized[0],
+                                             divisor->reciprocal, divisor->shift);
+    } else {
+        uint64_t un[9];
+        un[m] = limbs_lshift(un, a->words, m, divisor->shift);
+        limbs_divmod_norm(q ? quot.words : NULL, un, m, divisor->normalized, n, divisor->reciprocal);
+        limbs_rshift(rem.words, un, n, divisor->shift);
+    }
+
+    if (q) *q = quot;
+    *r = rem;
+}
+
+int512_error_t uint512_div_by(const uint512_t *a, const uint512_divisor_t *divisor,
+                              uint512_t *quotient, uint512_t *remainder) {
+    if (!a || !divisor || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
+    if (divisor->limbs == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    uint512_divmod_by(a, divisor, quotient, remainder);
+    return INT512_OK;
+}
+
+int512_error_t uint512_mod_by(const uint512_t *a, const uint512_divisor_t *divisor, uint512_t *remainder) {
+    if (!a || !divisor || !remainder) return INT512_ERR_NULL_POINTER;
+    if (divisor->limbs == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    uint512_divmod_by(a, divisor, NULL, remainder);
+    return INT512_OK;
+}
+
+int512_error_t int512_div_by(const int512_t *a, const uint512_divisor_t *divisor,
+                             int512_t *quotient, int512_t *remainder) {
+    if (!a || !divisor || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
+    if (divisor->limbs == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    int512_t abs_a = *a;
+    bool a_neg = int512_is_negative(a);
+    if (a_neg) {
+        int512_negate(&abs_a);
+    }
+
+    uint512_divmod_by((const uint512_t *)&abs_a, divisor, (uint512_t *)quotient, (uint512_t *)remainder);
+
+    if (a_neg != divisor->negative) {
+        int512_negate(quotient);
+    }
+    if (a_neg) {
+        int512_negate(remainder);
+    }
+    return INT512_OK;
+}
+
+int512_error_t int512_mod_by(const int512_t *a, const uint512_divisor_t *divisor, int512_t *remainder) {
+    if (!a || !divisor || !remainder) return INT512_ERR_NULL_POINTER;
+    if (divisor->limbs == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    int512_t abs_a = *a;
+    bool a_neg = int512_is_negative(a);
+    if (a_neg) {
+        int512_negate(&abs_a);
+    }
+
+    uint512_divmod_by((const uint512_t *)&abs_a, divisor, NULL, (uint512_t *)remainder);
+
+    if (a_neg) {
+        int512_negate(remainder);
+    }
+    return INT512_OK;
+}
+
+/* ============================================================================
+ * Montgomery Arithmetic
+ * ============================================================================
+ *
+ * Residues modulo an odd m of n limbs are kept as a R mod m with
+ * R = 2^(64 n), so that a product only needs the division-free Montgomery
+ * reduction t -> t / R mod m.  Multiplication interleaves the product and
+ * the reduction a limb at a time (CIOS, Koç et al. 1996); squaring builds
+ * the double-length square with the squaring kernels and reduces it after,
+ * which keeps the halved cross products.  The 4 and 8 limb cases are
+ * unrolled instances.
+ */
+
+/* -m^-1 mod 2^64 for odd m.  Each Newton step doubles the number of correct
+   low bits, starting from the 3 that m itself provides (m * m = 1 mod 8). */
+static uint64_t limb_neg_inverse(uint64_t m) {
+    uint64_t inv = m;
+    for (int i = 0; i < 5; i++) {
+        inv *= 2 - m * inv;
+    }
+    return (uint64_t)0 - inv;
+}
+
+/* r = a * b / R mod m for a, b < m.  r may alias a or b. */
+static inline __attribute__((always_inline))
+void mont_mul_cios(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, uint64_t m_inv, int n) {
+    uint64_t t[10] = {0};
+
+#pragma GCC unroll 8
+    for (int i = 0; i < n; i++) {
+        uint64_t c = 0;
+#pragma GCC unroll 8
+        for (int j = 0; j < n; j++) {
+            __uint128_t p = (__uint128_t)a[j] * b[i] + t[j] + c;
+            t[j] = (uint64_t)p;
+            c = (uint64_t)(p >> 64);
+        }
+        __uint128_t s = (__uint128_t)t[n] + c;
+        t[n] = (uint64_t)s;
+        t[n + 1] = (uint64_t)(s >> 64);
+
+        /* Adding q * m clears t[0]; shift down a limb as it is added */
+        uint64_t q = t[0] * m_inv;
+        __uint128_t p = (__uint128_t)q * m[0] + t[0];
+        c = (uint64_t)(p >> 64);
+#pragma GCC unroll 8
+        for (int j = 1; j < n; j++) {
+            p = (__uint128_t)q * m[j] + t[j] + c;
+            t[j - 1] = (uint64_t)p;
+            c = (uint64_t)(p >> 64);
+        }
+        s = (__uint128_t)t[n] + c;
+        t[n - 1] = (uint64_t)s;
+        t[n] = t[n + 1] + (uint64_t)(s >> 64);
+    }
+
+    mont_reduce_once(r, t, t[n], m, n);
+}
+
+static void mont_mul_limbs(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint512_mont_ctx_t *ctx) {
+    uint64_t t[16];
+
+    switch (ctx->limbs) {
+    case 8:
+        mul_kernels->mul_8x8(t, a, b);
+        mul_kernels->redc_8(r, t, ctx->modulus, ctx->m_inv);
+        break;
+    case 4:
+        mul_kernels->mul_4x4(t, a, b);
+        mul_kernels->redc_4(r, t, ctx->modulus, ctx->m_inv);
+        break;
+    default:
+        mont_mul_cios(r, a, b, ctx->modulus, ctx->m_inv, ctx->limbs);
+        break;
+    }
+}
+
+static void mont_sqr_limbs(uint64_t *r, const uint64_t *a, const uint512_mont_ctx_t *ctx) {
+    uint64_t t[16];
+
+    switch (ctx->limbs) {
+    case 8:
+        mul_kernels->sqr_8(t, a);
+        mul_kernels->redc_8(r, t, ctx->modulus, ctx->m_inv);
+        break;
+    case 4:
+        mul_kernels->sqr_4(t, a);
+        mul_kernels->redc_4(r, t, ctx->modulus, ctx->m_inv);
+        break;
+    default:
+        limbs_sqr_comba(t, 2 * ctx->limbs, a, ctx->limbs);
+        mont_redc(r, t, ctx->modulus, ctx->m_inv, ctx->limbs);
+        break;
+    }
+}
+
+int512_error_t uint512_mont_init(uint512_mont_ctx_t *ctx, const uint512_t *modulus) {
+    if (!ctx || !modulus) return INT512_ERR_NULL_POINTER;
+    if ((modulus->words[0] & 1) == 0) return INT512_ERR_INVALID_MODULUS;
+
+    int n = limbs_count(modulus->words, 8);
+    memset(ctx, 0, sizeof(*ctx));
+    memcpy(ctx->modulus, modulus->words, sizeof(ctx->modulus));
+    ctx->m_inv = limb_neg_inverse(modulus->words[0]);
+    ctx->limbs = n;
+
+    /* R^2 mod m as (R mod m)^2 mod m, keeping the dividends within 2n limbs */
+    if (n == 1) {
+        uint64_t m = modulus->words[0];
+        uint64_t r = (uint64_t)(((__uint128_t)1 << 64) % m);
+        ctx->r2[0] = (uint64_t)(((__uint128_t)r * r) % m);
+        return INT512_OK;
+    }
+
+    uint64_t u[16] = {0};
+    uint64_t r[8];
+    u[n] = 1;
+    limbs_divmod(NULL, r, u, n + 1, modulus->words, n);
+    limbs_mul_comba(u, 2 * n, r, n, r, n);
+    limbs_divmod(NULL, ctx->r2, u, 2 * n, modulus->words, n);
+
+    return INT512_OK;
+}
+
+int512_error_t uint512_to_mont(const uint512_mont_ctx_t *ctx, const uint512_t *a, uint512_t *result) {
+    if (!ctx || !a || !result) return INT512_ERR_NULL_POINTER;
+
+    int n = ctx->limbs;
+    uint64_t reduced[8], q[8];
+    const uint64_t *x = a->words;
+
+    /* a R^2 / R is fully reduced for any a < R; wider values need a
+       remainder first */
+    if (limbs_count(a->words, 8) > n) {
+        if (n == 1) {
+            reduced[0] = limbs_divrem_1(q, a->words, 8, ctx->modulus[0]);
+        } else {
+            limbs_divmod(NULL, reduced, a->words, 8, ctx->modulus, n);
+        }
+        x = reduced;
+    }
+
+    uint64_t r[8];
+    mont_mul_limbs(r, x, ctx->r2, ctx);
+    *result = UINT512_ZERO;
+    memcpy(result->words, r, (size_t)n * sizeof(uint64_t));
+
+    return INT512_OK;
+}
+
+int512_error_t uint512_from_mont(const uint512_mont_ctx_t *ctx, const uint512_t *a, uint512_t *result) {
+    if (!ctx || !a || !result) return INT512_ERR_NULL_POINTER;
+
+    int n = ctx->limbs;
+    uint64_t t[16] = {0};
+    uint64_t r[8];
+    memcpy(t, a->words, (size_t)n * sizeof(uint64_t));
+    mont_redc(r, t, ctx->modulus, ctx->m_inv, n);
+    *result = UINT512_ZERO;
+    memcpy(result->words, r, (size_t)n * sizeof(uint64_t));
+
+    return INT512_OK;
+}
+
+int512_error_t uint512_mont_mul(const uint512_mont_ctx_t *ctx, const uint512_t *a, const uint512_t *b,
+                                uint512_t *result) {
+    if (!ctx || !a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    int n = ctx->limbs;
+    mont_mul_limbs(result->words, a->words, b->words, ctx);
+    memset(result->words + n, 0, (size_t)(8 - n) * sizeof(uint64_t));
+
+    return INT512_OK;
+}
+
+int512_error_t uint512_mont_sqr(const uint512_mont_ctx_t *ctx, const uint512_t *a, uint512_t *result) {
+    if (!ctx || !a || !result) return INT512_ERR_NULL_POINTER;
+
+    int n = ctx->limbs;
+    mont_sqr_limbs(result->words, a->words, ctx);
+    memset(result->words + n, 0, (size_t)(8 - n) * sizeof(uint64_t));
+
+    return INT512_OK;
+}
+
+/* ============================================================================
+ * Barrett Reduction
+ * ============================================================================
+ *
+ * Barrett's method (HAC 14.42) for any nonzero modulus m of n limbs.  With
+ * b = 2^64 and mu = floor(b^(2n) / m) precomputed, x < b^(2n) is reduced by
+ * estimating q = floor(x / m) from the top n + 1 limbs of x times mu, which
+ * undershoots by at most 3, and subtracting q m in the low n + 1 limbs.
+ * Wider values are folded in from the top n limbs at a time.
+ */
+
+/* r[0..n-1] = x mod m for a 2n-limb x.  r may alias x. */
+static inline __attribute__((always_inline))
+void barrett_step(uint64_t *r, const uint64_t *x, const uint64_t *m, const uint64_t *mu, int n) {
+    uint64_t q3[9], t[9];
+    const uint64_t *q1 = x + n - 1;
+
+    /* q3 = floor(q1 mu / b^(n+1)), of which only the low n + 1 limbs
+       matter.  Columns below n - 1 are skipped; what they would carry in
+       is under b^(n+1), so q3 comes out at most one lower (HAC 14.44). */
+    __uint128_t acc = 0;
+    uint64_t acc_top = 0;
+#pragma GCC unroll 16
+    for (int k = n - 1; k <= 2 * n; k++) {
+        int i_start = k <= n ? 0 : k - n;
+        int i_end = k <= n ? k : n;
+#pragma GCC unroll 9
+        for (int i = i_start; i <= i_end; i++) {
+            __uint128_t prod = (__uint128_t)q1[i] * mu[k - i];
+            acc += prod;
+            acc_top += acc < prod;
+        }
+        if (k > n) q3[k - n - 1] = (uint64_t)acc;
+        acc = (acc >> 64) | ((__uint128_t)acc_top << 64);
+        acc_top = 0;
+    }
+    q3[n] = (uint64_t)acc;
+
+    /* mu reaches b^(n+1) when m = b^(n-1), which adds q1 itself */
+    if (mu[n + 1]) {
+        limbs_add_n(q3, q3, q1, n + 1);
+    }
+
+    limbs_mul_comba(t, n + 1, q3, n + 1, m, n);
+    limbs_sub_n(t, x, t, n + 1);
+    while (t[n] != 0 || limbs_cmp(t, m, n) >= 0) {
+        t[n] -= limbs_sub_n(t, t, m, n);
+    }
+    memcpy(r, t, (size_t)n * sizeof(uint64_t));
+}
+
+static void barrett_step_limbs(uint64_t *r, const uint64_t *x, const uint512_barrett_ctx_t *ctx) {
+    switch (ctx->limbs) {
+    case 1: barrett_step(r, x, ctx->modulus, ctx->mu, 1); break;
+    case 2: barrett_step(r, x, ctx->modulus, ctx->mu, 2); break;
+    case 3: barrett_step(r, x, ctx->modulus, ctx->mu, 3); break;
+    case 4: barrett_step(r, x, ctx->modulus, ctx->mu, 4); break;
+    case 5: barrett_step(r, x, ctx->modulus, ctx->mu, 5); break;
+    case 6: barrett_step(r, x, ctx->modulus, ctx->mu, 6); break;
+    case 7: barrett_step(r, x, ctx->modulus, ctx->mu, 7); break;
+    default: barrett_step(r, x, ctx->modulus, ctx->mu, 8); break;
+    }
+}
+
+/* result = x[0..xn-1] mod m, xn <= 16 */
+static void barrett_reduce(const uint512_barrett_ctx_t *ctx, const uint64_t *x, int xn, uint512_t *result) {
+    int n = ctx->limbs;
+    uint64_t t[16] = {0};
+    uint64_t r[8];
+
+    xn = limbs_count(x, xn);
+    if (xn <= 2 * n) {
+        memcpy(t, x, (size_t)xn * sizeof(uint64_t));
+        barrett_step_limbs(r, t, ctx);
+    } else {
+        /* r < m < b^n, so r b^c + (c fresh limbs) stays below b^(2n) */
+        int pos = xn - 2 * n;
+        barrett_step_limbs(r, x + pos, ctx);
+        while (pos > 0) {
+            int c = pos < n ? pos : n;
+            pos -= c;
+            memcpy(t, x + pos, (size_t)c * sizeof(uint64_t));
+            memcpy(t + c, r, (size_t)n * sizeof(uint64_t));
+            memset(t + c + n, 0, (size_t)(n - c) * sizeof(uint64_t));
+            barrett_step_limbs(r, t, ctx);
+        }
+    }
+
+    *result = UINT512_ZERO;
+    memcpy(result->words, r, (size_t)n * sizeof(uint64_t));
+}
+
+int512_error_t uint512_barrett_init(uint512_barrett_ctx_t *ctx, const uint512_t *modulus) {
+    if (!ctx || !modulus) return INT512_ERR_NULL_POINTER;
+    if (uint512_is_zero(modulus)) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    int n = limbs_count(modulus->words, 8);
+    memset(ctx, 0, sizeof(*ctx));
+    memcpy(ctx->modulus, modulus->words, sizeof(ctx->modulus));
+    ctx->limbs = n;
+
+    if (n == 1) {
+        uint64_t m = modulus->words[0];
+        __uint128_t q = ~(__uint128_t)0 / m;
+        ctx->mu[0] = (uint64_t)q;
+        ctx->mu[1] = (uint64_t)(q >> 64);
+        if (~(__uint128_t)0 % m == m - 1) {
+            limbs_incr(ctx->mu, 3, 1);
+        }
+        return INT512_OK;
+    }
+
+    /* b^(2n) itself does not fit the divider; divide b^(2n) - 1 and round
+       the quotient up when the remainder is m - 1 */
+    uint64_t u[16], r[8];
+    memset(u, 0xff, sizeof(u));
+    limbs_divmod(ctx->mu, r, u, 2 * n, modulus->words, n);
+    limbs_incr(r, n, 1);
+    if (limbs_cmp(r, modulus->words, n) == 0) {
+        limbs_incr(ctx->mu, n + 2, 1);
+    }
+
+    return INT512_OK;
+}
+
+int512_error_t uint512_barrett_mod(const uint512_barrett_ctx_t *ctx, const uint512_t *a, uint512_t *result) {
+    if (!ctx || !a || !result) return INT512_ERR_NULL_POINTER;
+
+    barrett_reduce(ctx, a->words, 8, result);
+    return INT512_OK;
+}
+
+int512_error_t uint512_barrett_mulmod(const uint512_barrett_ctx_t *ctx, const uint512_t *a, const uint512_t *b,
+                                      uint512_t *result) {
+    if (!ctx || !a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t t[16];
+    if (limbs_count(a->words, 8) <= 4 && limbs_count(b->words, 8) <= 4) {
+        mul_kernels->mul_4x4(t, a->words, b->words);
+        barrett_reduce(ctx, t, 8, result);
+    } else {
+        mul_kernels->mul_8x8(t, a->words, b->words);
+        barrett_reduce(ctx, t, 16, result);
+    }
+    return INT512_OK;
+}
+
+int512_error_t uint512_barrett_addmod(const uint512_barrett_ctx_t *ctx, const uint512_t *a, const uint512_t *b,
+                                      uint512_t *result) {
+    if (!ctx || !a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t t[9];
+    t[8] = limbs_add_n(t, a->words, b->words, 8);
+
+    /* Reduced operands need at most one subtraction */
+    if (limbs_cmp(a->words, ctx->modulus, 8) < 0 && limbs_cmp(b->words, ctx->modulus, 8) < 0) {
+        if (t[8] != 0 || limbs_cmp(t, ctx->modulus, 8) >= 0) {
+            limbs_sub_n(t, t, ctx->modulus, 8);
+        }
+        memcpy(result->words, t, sizeof(result->words));
+        return INT512_OK;
+    }
+
+    barrett_reduce(ctx, t, 9, result);
+    return INT512_OK;
+}
+
+/* The int512_t variants return residues as signed values, which needs
+   m <= 2^511 so that the largest residue is at most INT512_MAX */
+static bool barrett_signed_modulus_ok(const uint512_barrett_ctx_t *ctx) {
+    if ((ctx->modulus[7] >> 63) == 0) return true;
+    uint64_t rest = ctx->modulus[7] << 1;
+    for (int i = 0; i < 7; i++) rest |= ctx->modulus[i];
+    return rest == 0;
+}
+
+/* Non-negative residue of a signed value */
+static void barrett_reduce_signed(const uint512_barrett_ctx_t *ctx, const int512_t *a, uint512_t *result) {
+    int512_t abs_a = *a;
+    bool a_neg = int512_is_negative(a);
+    if (a_neg) {
+        int512_negate(&abs_a);
+    }
+
+    barrett_reduce(ctx, abs_a.words, 8, result);
+    if (a_neg && !uint512_is_zero(result)) {
+        limbs_sub_n(result->words, ctx->modulus, result->words, 8);
+    }
+}
+
+int512_error_t int512_barrett_mod(const uint512_barrett_ctx_t *ctx, const int512_t *a, int512_t *result) {
+    if (!ctx || !a || !result) return INT512_ERR_NULL_POINTER;
+    if (!barrett_signed_modulus_ok(ctx)) return INT512_ERR_INVALID_MODULUS;
+
+    barrett_reduce_signed(ctx, a, (uint512_t *)result);
+    return INT512_OK;
+}
+
+int512_error_t int512_barrett_mulmod(const uint512_barrett_ctx_t *ctx, const int512_t *a, const int512_t *b,
+                                     int512_t *result) {
+    if (!ctx || !a || !b || !result) return INT512_ERR_NULL_POINTER;
+    if (!barrett_signed_modulus_ok(ctx)) return INT512_ERR_INVALID_MODULUS;
+
+    uint512_t ra, rb;
+    barrett_reduce_signed(ctx, a, &ra);
+    barrett_reduce_signed(ctx, b, &rb);
+    return uint512_barrett_mulmod(ctx, &ra, &rb, (uint512_t *)result);
+}
+
+int512_error_t int512_barrett_addmod(const uint512_barrett_ctx_t *ctx, const int512_t *a, const int512_t *b,
+                                     int512_t *result) {
+    if (!ctx || !a || !b || !result) return INT512_ERR_NULL_POINTER;
+    if (!barrett_signed_modulus_ok(ctx)) return INT512_ERR_INVALID_MODULUS;
+
+    uint512_t ra, rb;
+    barrett_reduce_signed(ctx, a, &ra);
+    barrett_reduce_signed(ctx, b, &rb);
+    return uint512_barrett_addmod(ctx, &ra, &rb, (uint512_t *)result);
+}
+
+/* ============================================================================
+ * Modular Exponentiation
+ * ============================================================================ */
+
+/*
+ * Residue arithmetic for exponentiation: Montgomery form when the modulus
+ * is odd, otherwise plain residues with a Barrett reduction after each
+ * product.  Values are 8-limb arrays of which the low limbs hold the
+ * residue.
+ */
+typedef struct {
+    const uint512_mont_ctx_t *mont;        /* NULL: reduce with barrett */
+    const uint512_barrett_ctx_t *barrett;
+} powmod_ring_t;
+
+#define POWMOD_CT_WINDOW 5
+
+/* r = t mod m for a product t of two residues */
+static void powmod_reduce(const powmod_ring_t *ring, uint64_t *r, const uint64_t *t) {
+    memset(r, 0, 8 * sizeof(uint64_t));
+    barrett_step_limbs(r, t, ring->barrett);
+}
+
+static void powmod_mul(const powmod_ring_t *ring, uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    if (ring->mont) {
+        mont_mul_limbs(r, a, b, ring->mont);
+        return;
+    }
+    uint64_t t[16];
+    mul_kernels->mul_8x8(t, a, b);
+    powmod_reduce(ring, r, t);
+}
+
+static void powmod_sqr(const powmod_ring_t *ring, uint64_t *r, const uint64_t *a) {
+    if (ring->mont) {
+        mont_sqr_limbs(r, a, ring->mont);
+        return;
+    }
+    uint64_t t[16];
+    mul_kernels->sqr_8(t, a);
+    powmod_reduce(ring, r, t);
+}
+
+/*
+ * acc = g^e by left-to-right sliding windows.  Windows start and end on a
+ * set bit, so only odd powers g, g^3, ..., g^(2^w - 1) are tabulated; the
+ * window width grows with the exponent length.
+ */
+static void powmod_sliding(const powmod_ring_t *ring, uint64_t *acc, const uint64_t *g, const uint64_t *one,
+                           const uint64_t *e) {
+    int bits = limbs_bit_length(e, 8);
+    memcpy(acc, one, 8 * sizeof(uint64_t));
+    if (bits == 0) return;
+
+    int w = bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : 1;
+    uint64_t table[16][8] = {{0}};
+    memcpy(table[0], g, sizeof(table[0]));
+    if (w > 1) {
+        uint64_t g2[8] = {0};
+        powmod_sqr(ring, g2, g);
+        for (int k = 1; k < 1 << (w - 1); k++) {
+            powmod_mul(ring, table[k], table[k - 1], g2);
+        }
+    }
+
+    bool started = false;
+    int i = bits - 1;
+    while (i >= 0) {
+        if (!limbs_bit(e, i)) {
+            powmod_sqr(ring, acc, acc);
+            i--;
+            continue;
+        }
+
+        int j = i - w + 1 < 0 ? 0 : i - w + 1;
+        while (!limbs_bit(e, j)) j++;
+        unsigned window = 0;
+        for (int k = i; k >= j; k--) {
+            window = (window << 1) | (unsigned)limbs_bit(e, k);
+        }
+
+        if (started) {
+            for (int k = i; k >= j; k--) powmod_sqr(ring, acc, acc);
+            powmod_mul(ring, acc, acc, table[window >> 1]);
+        } else {
+            memcpy(acc, table[window >> 1], 8 * sizeof(uint64_t));
+            started = true;
+        }
+        i = j - 1;
+    }
+}
+
+/* r = table[index], reading every entry and selecting with masks so that
+   the memory accessed does not depend on index */
+static void powmod_ct_lookup(uint64_t *r, const uint64_t (*table)[8], unsigned index) {
+    memset(r, 0, 8 * sizeof(uint64_t));
+    for (unsigned k = 0; k < 1u << POWMOD_CT_WINDOW; k++) {
+        uint64_t d = k ^ index;
+        uint64_t mask = (uint64_t)0 - ((d - 1) >> 63);
+        for (int j = 0; j < 8; j++) {
+            r[j] |= table[k][j] & mask;
+        }
+    }
+}
+
+/* Exponent bits [lo, lo + width) as a number, without branching on them */
+static unsigned limbs_bits_at(const uint64_t *e, int lo, int width) {
+    unsigned v = 0;
+    for (int k = width - 1; k >= 0; k--) {
+        v = (v << 1) | (unsigned)limbs_bit(e, lo + k);
+    }
+    return v;
+}
+
+/*
+ * acc = g^e in Montgomery form with fixed windows over all 512 exponent
+ * bits: the same sequence of squarings, multiplications and full-table
+ * lookups runs for every exponent.
+ */
+static void powmod_fixed(const uint512_mont_ctx_t *ctx, uint64_t *acc, const uint64_t *g, const uint64_t *one,
+                         const uint64_t *e) {
+    uint64_t table[1 << POWMOD_CT_WINDOW][8] __attribute__((aligned(64)));
+    uint64_t t[8] = {0};
+
+    memset(table, 0, sizeof(table));
+    memcpy(table[0], one, sizeof(table[0]));
+    memcpy(table[1], g, sizeof(table[1]));
+    for (int k = 2; k < 1 << POWMOD_CT_WINDOW; k++) {
+        mont_mul_limbs(table[k], table[k - 1], g, ctx);
+    }
+
+    int pos = 512 - 512 % POWMOD_CT_WINDOW;
+    powmod_ct_lookup(acc, (const uint64_t (*)[8])table, limbs_bits_at(e, pos, 512 % POWMOD_CT_WINDOW));
+    while (pos > 0) {
+        pos -= POWMOD_CT_WINDOW;
+        for (int k = 0; k < POWMOD_CT_WINDOW; k++) {
+            mont_sqr_limbs(acc, acc, ctx);
+        }
+        powmod_ct_lookup(t, (const uint64_t (*)[8])table, limbs_bits_at(e, pos, POWMOD_CT_WINDOW));
+        mont_mul_limbs(acc, acc, t, ctx);
+    }
+}
+
+/* Montgomery forms of base and 1, zero-extended to 8 limbs */
+static void powmod_mont_setup(const uint512_mont_ctx_t *ctx, const uint512_t *base, uint64_t *g, uint64_t *one) {
+    uint512_t x = UINT512_ZERO;
+    uint512_to_mont(ctx, base, &x);
+    memcpy(g, x.words, sizeof(x.words));
+    uint512_to_mont(ctx, &UINT512_ONE, &x);
+    memcpy(one, x.words, sizeof(x.words));
+}
+
+int512_error_t uint512_mont_powmod(const uint512_mont_ctx_t *ctx, const uint512_t *base,
+                                   const uint512_t *exponent, uint512_t *result) {
+    if (!ctx || !base || !exponent || !result) return INT512_ERR_NULL_POINTER;
+
+    powmod_ring_t ring = {ctx, NULL};
+    uint64_t g[8], one[8], acc[8];
+    uint512_t x;
+
+    powmod_mont_setup(ctx, base, g, one);
+    powmod_sliding(&ring, acc, g, one, exponent->words);
+    memcpy(x.words, acc, sizeof(acc));
+    return uint512_from_mont(ctx, &x, result);
+}
+
+int512_error_t uint512_mont_powmod_ct(const uint512_mont_ctx_t *ctx, const uint512_t *base,
+                                      const uint512_t *exponent, uint512_t *result) {
+    if (!ctx || !base || !exponent || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t g[8], one[8], acc[8];
+    uint512_t x;
+
+    powmod_mont_setup(ctx, base, g, one);
+    powmod_fixed(ctx, acc, g, one, exponent->words);
+    memcpy(x.words, acc, sizeof(acc));
+    return uint512_from_mont(ctx, &x, result);
+}
+
+int512_error_t uint512_powmod(const uint512_t *base, const uint512_t *exponent, const uint512_t *modulus,
+                              uint512_t *result) {
+    if (!base || !exponent || !modulus || !result) return INT512_ERR_NULL_POINTER;
+    if (uint512_is_zero(modulus)) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    if (modulus->words[0] & 1) {
+        uint512_mont_ctx_t ctx;
+        uint512_mont_init(&ctx, modulus);
+        return uint512_mont_powmod(&ctx, base, exponent, result);
+    }
+
+    uint512_barrett_ctx_t barrett;
+    uint512_barrett_init(&barrett, modulus);
+    powmod_ring_t ring = {NULL, &barrett};
+    uint64_t one[8] = {1, 0, 0, 0, 0, 0, 0, 0};
+    uint512_t g;
+
+    barrett_reduce(&barrett, base->words, 8, &g);
+    powmod_sliding(&ring, result->words, g.words, one, exponent->words);
+    return INT512_OK;
+}
+
+int512_error_t uint512_powmod_ct(const uint512_t *base, const uint512_t *exponent, const uint512_t *modulus,
+                                 uint512_t *result) {
+    if (!base || !exponent || !modulus || !result) return INT512_ERR_NULL_POINTER;
+    if (uint512_is_zero(modulus)) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    uint512_mont_ctx_t ctx;
+    int512_error_t err = uint512_mont_init(&ctx, modulus);
+    if (err != INT512_OK) return err;
+    return uint512_mont_powmod_ct(&ctx, base, exponent, result);
+}
+
+/* ============================================================================
+ * GCD and Modular Inverse
+ * ============================================================================
+ *
+ * Multi-limb remainders follow Lehmer's algorithm (Knuth, TAOCP vol. 2,
+ * 4.5.2, Algorithm L): Euclid runs on the leading 63 bits of u and v with a
+ * 2x2 cofactor matrix for as long as the single-precision quotients are
+ * certain to be the true ones, and the matrix is then applied to u and v in
+ * one pass.  Once v fits in a limb the rest is single precision, with a
+ * binary GCD when no cofactors are wanted.  The cofactors of consecutive
+ * remainders alternate in sign, so only their magnitudes and the parity of
+ * the step count are kept.
+ */
+
+/* Binary GCD of two limbs */
+static uint64_t limb_gcd(uint64_t u, uint64_t v) {
+    if (u == 0) return v;
+    if (v == 0) return u;
+
+    int shift = limb_ctz(u | v);
+    u >>= limb_ctz(u);
+    do {
+        v >>= limb_ctz(v);
+        if (u > v) {
+            uint64_t t = u;
+            u = v;
+            v = t;
+        }
+        v -= u;
+    } while (v != 0);
+    return u << shift;
+}
+
+typedef struct {
+    uint64_t u[8], v[8];    /* Consecutive remainders, u >= v */
+    uint64_t xu[8], xv[8];  /* Magnitudes of their cofactors of a */
+    bool cofactors;         /* Whether xu and xv are maintained */
+    int steps;              /* Euclid steps so far; xu has sign (-1)^steps */
+} gcd_state_t;
+
+/* One Euclid step with a full quotient: (u, v) = (v, u mod v) */
+static void gcd_divide_step(gcd_state_t *s) {
+    uint64_t q[8] = {0}, r[8] = {0};
+    int un = limbs_count(s->u, 8);
+    int vn = limbs_count(s->v, 8);
+
+    if (un < vn) {
+        memcpy(r, s->u, sizeof(r));
+    } else if (vn == 1) {
+        r[0] = limbs_divrem_1(q, s->u, un, s->v[0]);
+    } else {
+        limbs_divmod(q, r, s->u, un, s->v, vn);
+    }
+
+    if (s->cofactors) {
+        /* xv' = xu + q xv, which stays below b */
+        uint64_t t[8];
+        memcpy(t, s->xu, sizeof(t));
+        for (int i = 0; i <= un - vn; i++) {
+            if (q[i]) limbs_addmul_1(t + i, s->xv, 8 - i, q[i]);
+        }
+        memcpy(s->xu, s->xv, sizeof(s->xu));
+        memcpy(s->xv, t, sizeof(s->xv));
+    }
+    memcpy(s->u, s->v, sizeof(s->u));
+    memcpy(s->v, r, sizeof(s->v));
+    s->steps++;
+}
+
+/* r = x p - y q over 8 limbs, for a non-negative result.  r may alias x. */
+static void limbs_mul_sub_2(uint64_t *r, const uint64_t *x, uint64_t p, const uint64_t *y, uint64_t q) {
+    uint64_t t[8];
+    limbs_mul_1_add(t, y, 8, q, 0);
+    limbs_mul_1_add(r, x, 8, p, 0);
+    limbs_sub_n(r, r, t, 8);
+}
+
+/* r = x p + y q over 8 limbs, for a result below 2^512.  r may alias y. */
+static void limbs_mul_add_2(uint64_t *r, const uint64_t *x, uint64_t p, const uint64_t *y, uint64_t q) {
+    uint64_t t[8];
+    limbs_mul_1_add(t, x, 8, p, 0);
+    limbs_mul_1_add(r, y, 8, q, 0);
+    limbs_add_n(r, r, t, 8);
+}
+
+/* Bits [lo, lo + 63) of an 8-limb value */
+static int64_t limbs_bits_63(const uint64_t *x, int lo) {
+    int w = lo / 64, sh = lo % 64;
+    uint64_t bits = x[w] >> sh;
+    if (sh != 0 && w < 7) {
+        bits |= x[w + 1] << (64 - sh);
+    }
+    return (int64_t)(bits & (UINT64_MAX >> 1));
+}
+
+/*
+ * One Lehmer step for a multi-limb v.  When the leading bits do not settle
+ * even the first quotient, which happens when it is large, a full division
+ * step is taken instead.
+ */
+static void gcd_lehmer_step(gcd_state_t *s) {
+    int lo = limbs_bit_length(s->u, 8) - 63;
+    int64_t uh = limbs_bits_63(s->u, lo);
+    int64_t vh = limbs_bits_63(s->v, lo);
+    int64_t a = 1, b = 0, c = 0, d = 1;
+    int k = 0;
+
+    /* The true quotient lies between the two estimates.  The sums below
+       stay within [0, 2^63] (Knuth) and the cofactors within 2^63 in
+       magnitude, so unsigned wrapping arithmetic is exact. */
+    for (;;) {
+        uint64_t vc = (uint64_t)vh + (uint64_t)c;
+        uint64_t vd = (uint64_t)vh + (uint64_t)d;
+        if (vc == 0 || vd == 0) break;
+        uint64_t q = ((uint64_t)uh + (uint64_t)a) / vc;
+        uint64_t ub = (uint64_t)uh + (uint64_t)b;
+        __uint128_t qd = (__uint128_t)q * vd;
+        if (qd > ub || qd + vd <= ub) break;
+
+        int64_t t = (int64_t)((uint64_t)a - q * (uint64_t)c);
+        a = c;
+        c = t;
+        t = (int64_t)((uint64_t)b - q * (uint64_t)d);
+        b = d;
+        d = t;
+        t = (int64_t)((uint64_t)uh - q * (uint64_t)vh);
+        uh = vh;
+        vh = t;
+        k++;
+    }
+
+    if (b == 0) {
+        gcd_divide_step(s);
+        return;
+    }
+
+    /* After k steps a and d have the sign (-1)^k, b and c the opposite */
+    uint64_t ma = (uint64_t)(a < 0 ? -a : a), mb = (uint64_t)(b < 0 ? -b : b);
+    uint64_t mc = (uint64_t)(c < 0 ? -c : c), md = (uint64_t)(d < 0 ? -d : d);
+    uint64_t u[8];
+    if (k % 2 == 0) {
+        limbs_mul_sub_2(u, s->u, ma, s->v, mb);
+        limbs_mul_sub_2(s->v, s->v, md, s->u, mc);
+    } else {
+        limbs_mul_sub_2(u, s->v, mb, s->u, ma);
+        limbs_mul_sub_2(s->v, s->u, mc, s->v, md);
+    }
+    memcpy(s->u, u, sizeof(u));
+
+    if (s->cofactors) {
+        uint64_t xu[8];
+        limbs_mul_add_2(xu, s->xu, ma, s->xv, mb);
+        limbs_mul_add_2(s->xv, s->xu, mc, s->xv, md);
+        memcpy(s->xu, xu, sizeof(xu));
+    }
+    s->steps += k;
+}
+
+/*
+ * Runs Euclid on (a, b) until v is zero, leaving gcd(a, b) in s->u and, with
+ * cofactors, |x| for a x = gcd (mod b) in s->xu.
+ */
+static void gcd_run(gcd_state_t *s, const uint64_t *a, const uint64_t *b, bool cofactors) {
+    memcpy(s->u, a, sizeof(s->u));
+    memcpy(s->v, b, sizeof(s->v));
+    memset(s->xu, 0, sizeof(s->xu));
+    memset(s->xv, 0, sizeof(s->xv));
+    s->xu[0] = 1;
+    s->cofactors = cofactors;
+    s->steps = 0;
+
+    if (limbs_cmp(s->u, s->v, 8) < 0) {
+        gcd_divide_step(s);
+    }
+    while (limbs_count(s->v, 8) > 1) {
+        gcd_lehmer_step(s);
+    }
+
+    if (cofactors) {
+        while (s->v[0] != 0) {
+            gcd_divide_step(s);
+        }
+    } else if (s->v[0] != 0) {
+        uint64_t q[8];
+        uint64_t r = limbs_divrem_1(q, s->u, 8, s->v[0]);
+        memset(s->u, 0, sizeof(s->u));
+        s->u[0] = limb_gcd(s->v[0], r);
+        s->v[0] = 0;
+    }
+}
+
+int512_error_t uint512_gcd(const uint512_t *a, const uint512_t *b, uint512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    if (limbs_count(a->words, 8) <= 1 && limbs_count(b->words, 8) <= 1) {
+        uint64_t g = limb_gcd(a->words[0], b->words[0]);
+        *result = UINT512_ZERO;
+        result->words[0] = g;
+        return INT512_OK;
+    }
+
+    gcd_state_t s;
+    gcd_run(&s, a->words, b->words, false);
+    memcpy(result->words, s.u, sizeof(s.u));
+    return INT512_OK;
+}
+
+int512_error_t uint512_xgcd(const uint512_t *a, const uint512_t *b, uint512_t *gcd, int512_t *x, int512_t *y) {
+    if (!a || !b || !gcd || !x || !y) return INT512_ERR_NULL_POINTER;
+
+    gcd_state_t s;
+    gcd_run(&s, a->words, b->words, true);
+
+    /* |x| <= b / 2g and |y| <= a / 2g, so both fit in int512_t */
+    bool x_zero = limbs_count(s.xu, 8) == 0;
+    bool x_neg = (s.steps & 1) && !x_zero;
+    uint64_t t[16], q[16] = {0};
+    int bn = limbs_count(b->words, 8);
+
+    /* y = (g - a x) / b exactly, with g - a x of the sign of -x (of g when
+       x is zero) */
+    if (bn > 0) {
+        limbs_mul_comba(t, 16, a->words, 8, s.xu, 8);
+        if (x_neg || x_zero) {
+            limbs_incr(t + 8, 8, limbs_add_n(t, t, s.u, 8));
+        } else {
+            uint64_t borrow = limbs_sub_n(t, t, s.u, 8);
+            for (int i = 8; borrow && i < 16; i++) {
+                borrow = t[i]-- == 0;
+            }
+        }
+
+        int tn = limbs_count(t, 16);
+        if (bn == 1) {
+            limbs_divrem_1(q, t, tn, b->words[0]);
+        } else if (tn >= bn) {
+            uint64_t r[8];
+            limbs_divmod(q, r, t, tn, b->words, bn);
+        }
+    }
+
+    memcpy(gcd->words, s.u, sizeof(s.u));
+    memcpy(x->words, s.xu, sizeof(s.xu));
+    memcpy(y->words, q, sizeof(y->words));
+    if (x_neg) {
+        int512_negate(x);
+    } else if (!x_zero) {
+        int512_negate(y);
+    }
+    return INT512_OK;
+}
+
+int512_error_t uint512_modinv(const uint512_t *a, const uint512_t *modulus, uint512_t *result) {
+    if (!a || !modulus || !result) return INT512_ERR_NULL_POINTER;
+    if (uint512_is_zero(modulus)) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    gcd_state_t s;
+    gcd_run(&s, a->words, modulus->words, true);
+    if (limbs_count(s.u, 8) != 1 || s.u[0] != 1) return INT512_ERR_NOT_INVERTIBLE;
+
+    /* |x| <= m / 2, so a negative x is brought into range with one m */
+    if ((s.steps & 1) && limbs_count(s.xu, 8) != 0) {
+        limbs_sub_n(result->words, modulus->words, s.xu, 8);
+    } else {
+        memcpy(result->words, s.xu, sizeof(s.xu));
+    }
+    return INT512_OK;
+}
+
+/*
+ * Constant-time inverse for an odd modulus by the binary extended Euclidean
+ * algorithm.  Every iteration conditionally swaps f and g so that f >= g
+ * when f is odd, subtracts g from f when f is odd and halves f, mirroring
+ * each step on the cofactors u and v mod m; all conditions become masks.
+ * f g halves at least once per iteration, so 512 + bits(m) iterations
+ * always bring f to zero and leave gcd(a, m) in g.
+ */
+int512_error_t uint512_modinv_ct(const uint512_t *a, const uint512_t *modulus, uint512_t *result) {
+    if (!a || !modulus || !result) return INT512_ERR_NULL_POINTER;
+    if (uint512_is_zero(modulus)) return INT512_ERR_DIVIDE_BY_ZERO;
+    if ((modulus->words[0] & 1) == 0) return INT512_ERR_INVALID_MODULUS;
+
+    const uint64_t *m = modulus->words;
+    if (limbs_count(m, 8) == 1 && m[0] == 1) {
+        *result = UINT512_ZERO;
+        return INT512_OK;
+    }
+
+    /* u a = f and v a = g (mod m) throughout */
+    uint64_t f[8], g[8], u[8] = {1}, v[8] = {0};
+    memcpy(f, a->words, sizeof(f));
+    memcpy(g, m, sizeof(g));
+
+    int iterations = 512 + limbs_bit_length(m, 8);
+    for (int it = 0; it < iterations; it++) {
+        uint64_t odd = (uint64_t)0 - (f[0] & 1);
+        uint64_t borrow = 0, carry = 0, t;
+
+        for (int i = 0; i < 8; i++) {
+            limb_subb(f[i], g[i], borrow, &borrow);
+        }
+        uint64_t swap = odd & ((uint64_t)0 - borrow);
+        for (int i = 0; i < 8; i++) {
+            t = (f[i] ^ g[i]) & swap;
+            f[i] ^= t;
+            g[i] ^= t;
+            t = (u[i] ^ v[i]) & swap;
+            u[i] ^= t;
+            v[i] ^= t;
+        }
+
+        borrow = 0;
+        for (int i = 0; i < 8; i++) {
+            f[i] = limb_subb(f[i], g[i] & odd, borrow, &borrow);
+        }
+        borrow = 0;
+        for (int i = 0; i < 8; i++) {
+            u[i] = limb_subb(u[i], v[i] & odd, borrow, &borrow);
+        }
+        uint64_t wrap = (uint64_t)0 - borrow;
+        for (int i = 0; i < 8; i++) {
+            u[i] = limb_addc(u[i], m[i] & wrap, carry, &carry);
+        }
+
+        /* f is even now; u / 2 mod m is (u + m) / 2 for an odd u */
+        limbs_rshift(f, f, 8, 1);
+        uint64_t half = (uint64_t)0 - (u[0] & 1);
+        carry = 0;
+        for (int i = 0; i < 8; i++) {
+            u[i] = limb_addc(u[i], m[i] & half, carry, &carry);
+        }
+        limbs_rshift(u, u, 8, 1);
+        u[7] |= carry << 63;
+    }
+
+    if (limbs_count(g, 8) != 1 || g[0] != 1) return INT512_ERR_NOT_INVERTIBLE;
+    memcpy(result->words, v, sizeof(v));
+    return INT512_OK;
+}
+
+/* ============================================================================
+ * Integer Roots
+ * ============================================================================
+ *
+ * Both roots run Newton's iteration x' = ((k-1) x + a / x^(k-1)) / k on
+ * integers.  By the AM-GM inequality x' is never below the root, and from
+ * any x above the root it decreases strictly, so the iteration stops at the
+ * root as soon as x' >= x (Brent and Zimmermann, Modern Computer
+ * Arithmetic, 1.5.1).  The starting point comes from the leading bits of a
+ * in long double precision, which leaves only a few doublings of the
+ * correct bits, each costing one Algorithm D division.
+ */
+
+/* floor(sqrt(t)) for t < 2^128 */
+static uint64_t limb_sqrt_2(__uint128_t t) {
+    long double s = sqrtl((long double)t);
+    uint64_t r = s >= 18446744073709551615.0L ? UINT64_MAX : (uint64_t)s;
+
+    /* sqrtl may be off by an ulp either way */
+    while ((__uint128_t)r * r > t) r--;
+    while (r < UINT64_MAX && (__uint128_t)(r + 1) * (r + 1) <= t) r++;
+    return r;
+}
+
+/*
+ * floor(sqrt(a)) or one more, for a of the given bit length.  With the root
+ * of t = a / 4^s known to within 2, (root(t) + 1) 2^s is at most 3 2^s above
+ * sqrt(a), and one Newton step brings that error down to 9 2^(2s) / 2^bits(root),
+ * which is below 1 for the s used here.  Only the last step divides at full
+ * precision, the same recursive shape as Zimmermann's Karatsuba square root.
+ */
+static void isqrt_approx(const uint512_t *a, int bits, uint512_t *x) {
+    *x = UINT512_ZERO;
+    if (bits <= 128) {
+        x->words[0] = limb_sqrt_2(((__uint128_t)a->words[1] << 64) | a->words[0]);
+        return;
+    }
+
+    int s = ((bits + 1) / 2 - 4) / 2;
+    uint512_t t, q = UINT512_ZERO, rem;
+    uint512_shr(a, (unsigned int)(2 * s), &t);
+    isqrt_approx(&t, bits - 2 * s, x);
+    limbs_incr(x->words, 8, 1);
+    uint512_shl(x, (unsigned int)s, x);
+
+    limbs_divmod(q.words, rem.words, a->words, limbs_count(a->words, 8), x->words, limbs_count(x->words, 8));
+    limbs_add_n(x->words, x->words, q.words, 8);
+    limbs_rshift(x->words, x->words, 8, 1);
+}
+
+int512_error_t uint512_isqrt(const uint512_t *a, uint512_t *root, uint512_t *remainder) {
+    if (!a || !root) return INT512_ERR_NULL_POINTER;
+
+    uint512_t x, square;
+    isqrt_approx(a, limbs_bit_length(a->words, 8), &x);
+    if (x.words[4]) {
+        /* Only 2^256 itself, one above the largest root */
+        memset(x.words, 0xff, 4 * sizeof(uint64_t));
+        x.words[4] = 0;
+    }
+    uint512_sqr(&x, &square);
+    if (limbs_cmp(square.words, a->words, 8) > 0) {
+        /* (x - 1)^2 = x^2 - x - (x - 1) */
+        limbs_sub_n(square.words, square.words, x.words, 8);
+        limbs_sub_n(x.words, x.words, UINT512_ONE.words, 8);
+        limbs_sub_n(square.words, square.words, x.words, 8);
+    }
+
+    if (remainder) {
+        limbs_sub_n(remainder->words, a->words, square.words, 8);
+    }
+    *root = x;
+    return INT512_OK;
+}
+
+/* r = x^e by left-to-right binary powering; false if x^e >= 2^512 */
+static bool uint512_pow_fits(const uint512_t *x, unsigned int e, uint512_t *r) {
+    uint512_t acc = UINT512_ONE;
+    for (int i = 31 - __builtin_clz(e | 1); i >= 0; i--) {
+        if (uint512_sqr(&acc, &acc) != INT512_OK) return false;
+        if (((e >> i) & 1) && uint512_mul(&acc, x, &acc) != INT512_OK) return false;
+    }
+    *r = acc;
+    return true;
+}
+
+/* One Newton step for the k-th root of a from x > 0 */
+static void iroot_step(const uint512_t *a, unsigned int k, const uint512_t *x, uint512_t *y) {
+    /* (k - 1) x + a / x^(k-1) can exceed 512 bits when a is close to 2^512 */
+    uint64_t sum[9] = {0};
+    uint512_t p;
+    if (uint512_pow_fits(x, k - 1, &p)) {
+        uint512_t rem;
+        uint512_div(a, &p, (uint512_t *)sum, &rem);
+    }
+    sum[8] = limbs_addmul_1(sum, x->words, 8, k - 1);
+    limbs_divrem_1(sum, sum, 9, k);
+    memcpy(y->words, sum, sizeof(y->words));
+}
+
+int512_error_t uint512_iroot(const uint512_t *a, unsigned int k, uint512_t *result) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+    if (k == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+    if (k == 1) {
+        *result = *a;
+        return INT512_OK;
+    }
+    if (k == 2) return uint512_isqrt(a, result, NULL);
+
+    /* a < 2^k has root 0 or 1 */
+    int bits = limbs_bit_length(a->words, 8);
+    if ((unsigned int)bits <= k) {
+        *result = bits ? UINT512_ONE : UINT512_ZERO;
+        return INT512_OK;
+    }
+
+    /* 2^(log2(a) / k) from the leading 64 bits of a, rounded up past the
+       error of log2l and exp2l to a 53-bit over-estimate */
+    int s = bits > 64 ? bits - 64 : 0;
+    uint512_t t;
+    uint512_shr(a, (unsigned int)s, &t);
+    long double e = (log2l((long double)t.words[0]) + s) / k;
+    int shift = (int)e > 52 ? (int)e - 52 : 0;
+    long double mant = exp2l(e - shift) * (1.0L + 0x1p-40L);
+    uint512_t x = UINT512_ZERO;
+    x.words[0] = (uint64_t)mant + 1;
+    uint512_shl(&x, (unsigned int)shift, &x);
+
+    /* The first step lands on or above the root even from below it */
+    uint512_t y;
+    iroot_step(a, k, &x, &y);
+    for (;;) {
+        x = y;
+        iroot_step(a, k, &x, &y);
+        if (uint512_compare(&y, &x) >= 0) break;
+    }
+    *result = x;
+    return INT512_OK;
+}
+
+/*
+ * Squares are first filtered by quadratic residues modulo 64, 63, 65 and 11;
+ * only about one non-square in 120 passes all four and needs the root.  The
+ * last three come from a single remainder by 45045 = 63 * 65 * 11.
+ */
+bool uint512_is_perfect_square(const uint512_t *a) {
+    static const uint64_t qr64 = 0x0202021202030213ULL;
+    static const uint64_t qr63 = 0x0402483012450293ULL;
+    static const uint64_t qr65 = 0x218a019866014613ULL; /* and 64 */
+    static const uint64_t qr11 = 0x23b;
+
+    if (!a) return false;
+    if (!((qr64 >> (a->words[0] & 63)) & 1)) return false;
+
+    uint64_t r = limbs_divrem_1(NULL, a->words, 8, 45045);
+    if (!((qr63 >> (r % 63)) & 1)) return false;
+    if (r % 65 != 64 && !((qr65 >> (r % 65)) & 1)) return false;
+    if (!((qr11 >> (r % 11)) & 1)) return false;
+
+    uint512_t root, rem;
+    uint512_isqrt(a, &root, &rem);
+    return uint512_is_zero(&rem);
+}
+
+/* ============================================================================
+ * Primality Testing
+ * ============================================================================
+ *
+ * Baillie-PSW: trial division by the odd primes below 1024, a strong
+ * probable-prime test to base 2 and a strong Lucas probable-prime test with
+ * Selfridge's parameters (Baillie and Wagstaff 1980).  No composite below
+ * 2^64 passes both tests, and none is known above.  The residue arithmetic
+ * of both tests runs in Montgomery form on the context of n.
+ */
+
+static const uint16_t small_primes[] = {
+    3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59,
+    61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131, 137,
+    139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227,
+    229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283, 293, 307, 311, 313,
+    317, 331, 337, 347, 349, 353, 359, 367, 373, 379, 383, 389, 397, 401, 409, 419,
+    421, 431, 433, 439, 443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509,
+    521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617,
+    619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727,
+    733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829,
+    839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947,
+    953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021,
+};
+
+#define SMALL_PRIMES (int)(sizeof(small_primes) / sizeof(small_primes[0]))
+
+/* Runs of small_primes whose products fit in a limb; trial division takes
+   one remainder per run and reduces it by each prime of the run */
+static struct {
+    uint512_divisor_u64_t divisor;
+    int end;
+} trial_groups[SMALL_PRIMES];
+static int trial_group_count;
+
+__attribute__((constructor))
+static void trial_groups_init(void) {
+    uint64_t product = 1;
+    for (int i = 0; i < SMALL_PRIMES; i++) {
+        if (product > UINT64_MAX / small_primes[i]) {
+            uint512_divisor_u64_init(&trial_groups[trial_group_count].divisor, product);
+            trial_groups[trial_group_count++].end = i;
+            product = 1;
+        }
+        product *= small_primes[i];
+    }
+    uint512_divisor_u64_init(&trial_groups[trial_group_count].divisor, product);
+    trial_groups[trial_group_count++].end = SMALL_PRIMES;
+}
+
+/* Jacobi symbol (a/n) for odd n */
+static int limb_jacobi(uint64_t a, uint64_t n) {
+    int t = 1;
+    a %= n;
+    while (a != 0) {
+        int z = limb_ctz(a);
+        a >>= z;
+        if ((z & 1) && ((n & 7) == 3 || (n & 7) == 5)) t = -t;
+        if ((a & 3) == 3 && (n & 3) == 3) t = -t;
+        uint64_t r = n % a;
+        n = a;
+        a = r;
+    }
+    return n == 1 ? t : 0;
+}
+
+/* Jacobi symbol (d/n) for an odd small d and odd n, by reciprocity */
+static int jacobi_small(int64_t d, const uint64_t *n, int limbs) {
+    uint64_t abs_d = d < 0 ? (uint64_t)-d : (uint64_t)d;
+    int t = limb_jacobi(limbs_divrem_1(NULL, n, limbs, abs_d), abs_d);
+    if ((abs_d & 3) == 3 && (n[0] & 3) == 3) t = -t;
+    if (d < 0 && (n[0] & 3) == 3) t = -t;
+    return t;
+}
+
+/* Residue arithmetic modulo m over n limbs, for operands below m */
+static void mod_add_limbs(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, int n) {
+    if (limbs_add_n(r, a, b, n) || limbs_cmp(r, m, n) >= 0) {
+        limbs_sub_n(r, r, m, n);
+    }
+}
+
+static void mod_sub_limbs(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *m, int n) {
+    if (limbs_sub_n(r, a, b, n)) {
+        limbs_add_n(r, r, m, n);
+    }
+}
+
+/* r = a / 2 mod m for odd m */
+static void mod_half_limbs(uint64_t *r, const uint64_t *a, const uint64_t *m, int n) {
+    uint64_t carry = 0;
+    if (a[0] & 1) {
+        carry = limbs_add_n(r, a, m, n);
+    } else if (r != a) {
+        memcpy(r, a, (size_t)n * sizeof(uint64_t));
+    }
+    limbs_rshift(r, r, n, 1);
+    r[n - 1] |= carry << 63;
+}
+
+/* r = c a mod m for a small nonzero c, by doubling and adding */
+static void mod_mul_small_limbs(uint64_t *r, const uint64_t *a, int64_t c, const uint64_t *m, int n) {
+    uint64_t abs_c = c < 0 ? (uint64_t)-c : (uint64_t)c;
+    uint64_t acc[8];
+    memcpy(acc, a, (size_t)n * sizeof(uint64_t));
+    for (int i = 62 - limb_clz(abs_c); i >= 0; i--) {
+        mod_add_limbs(acc, acc, acc, m, n);
+        if ((abs_c >> i) & 1) mod_add_limbs(acc, acc, a, m, n);
+    }
+    if (c < 0 && limbs_count(acc, n)) {
+        limbs_sub_n(acc, m, acc, n);
+    }
+    memcpy(r, acc, (size_t)n * sizeof(uint64_t));
+}
+
+/*
+ * Strong probable prime to base 2: with n - 1 = d 2^s and d odd, 2^d is 1 or
+ * 2^(d 2^r) is -1 for some r < s.  The multiplications by the base in the
+ * left-to-right ladder are doublings.
+ */
+static bool is_sprp_2(const uint512_mont_ctx_t *ctx, const uint64_t *one) {
+    int n = ctx->limbs;
+    const uint64_t *m = ctx->modulus;
+    uint64_t d[8], minus_one[8], x[8] = {0};
+
+    memcpy(d, m, sizeof(d));
+    d[0] &= ~(uint64_t)1;
+    int s = 1;
+    while (!limbs_bit(d, s)) s++;
+    limbs_sub_n(minus_one, m, one, 8);
+
+    mod_add_limbs(x, one, one, m, n);
+    for (int i = limbs_bit_length(d, 8) - 2; i >= s; i--) {
+        mont_sqr_limbs(x, x, ctx);
+        if (limbs_bit(d, i)) mod_add_limbs(x, x, x, m, n);
+    }
+
+    if (limbs_cmp(x, one, n) == 0 || limbs_cmp(x, minus_one, n) == 0) return true;
+    for (int r = 1; r < s; r++) {
+        mont_sqr_limbs(x, x, ctx);
+        if (limbs_cmp(x, minus_one, n) == 0) return true;
+        if (limbs_cmp(x, one, n) == 0) return false;
+    }
+    return false;
+}
+
+/*
+ * Strong Lucas probable prime with P = 1 and Q = (1 - D) / 4: with
+ * n + 1 = d 2^s and d odd, U_d is 0 or V_(d 2^r) is 0 for some r < s.  U and
+ * V are carried up the bits of d with the doubling formulas
+ * U_2k = U_k V_k, V_2k = V_k^2 - 2 Q^k and the increments
+ * U_k+1 = (U_k + V_k) / 2, V_k+1 = (D U_k + V_k) / 2.  D and Q are small, so
+ * their products are additions rather than Montgomery multiplications.
+ */
+static bool is_slprp(const uint512_mont_ctx_t *ctx, const uint64_t *one, int64_t D) {
+    int n = ctx->limbs;
+    const uint64_t *m = ctx->modulus;
+    int64_t Q = (1 - D) / 4;
+    uint64_t d[8], u[8] = {0}, v[8] = {0}, qk[8] = {0}, t[8] = {0};
+
+    /* n + 1 does not wrap: 2^512 - 1 is divisible by 3 */
+    memcpy(d, m, sizeof(d));
+    limbs_incr(d, 8, 1);
+    int s = 0;
+    while (!limbs_bit(d, s)) s++;
+
+    memcpy(u, one, (size_t)n * sizeof(uint64_t));
+    memcpy(v, one, (size_t)n * sizeof(uint64_t));
+    mod_mul_small_limbs(qk, one, Q, m, n);
+
+    for (int i = limbs_bit_length(d, 8) - 2; i >= s; i--) {
+        mont_mul_limbs(u, u, v, ctx);
+        mont_sqr_limbs(v, v, ctx);
+        mod_add_limbs(t, qk, qk, m, n);
+        mod_sub_limbs(v, v, t, m, n);
+        mont_sqr_limbs(qk, qk, ctx);
+
+        if (limbs_bit(d, i)) {
+            mod_mul_small_limbs(t, u, D, m, n);
+            mod_add_limbs(u, u, v, m, n);
+            mod_half_limbs(u, u, m, n);
+            mod_add_limbs(v, t, v, m, n);
+            mod_half_limbs(v, v, m, n);
+            mod_mul_small_limbs(qk, qk, Q, m, n);
+        }
+    }
+
+    if (limbs_count(u, n) == 0 || limbs_count(v, n) == 0) return true;
+    for (int r = 1; r < s; r++) {
+        mont_sqr_limbs(v, v, ctx);
+        mod_add_limbs(t, qk, qk, m, n);
+        mod_sub_limbs(v, v, t, m, n);
+        if (limbs_count(v, n) == 0) return true;
+        mont_sqr_limbs(qk, qk, ctx);
+    }
+    return false;
+}
+
+bool uint512_is_probable_prime(const uint512_t *a) {
+    if (!a) return false;
+
+    const uint64_t *w = a->words;
+    int limbs = limbs_count(w, 8);
+    if (limbs <= 1 && w[0] < 4) return w[0] >= 2;
+    if ((w[0] & 1) == 0) return false;
+
+    for (int g = 0, i = 0; g < trial_group_count; g++) {
+        const uint512_divisor_u64_t *divisor = &trial_groups[g].divisor;
+        uint64_t r = limbs_divrem_1_preinv(NULL, w, limbs, divisor->normalized, divisor->reciprocal,
+                                           divisor->shift);
+        for (; i < trial_groups[g].end; i++) {
+            if (r % small_primes[i] == 0) return limbs == 1 && w[0] == small_primes[i];
+        }
+    }
+    if (limbs == 1 && w[0] < 1024 * 1024) return true;
+
+    uint512_mont_ctx_t ctx;
+    uint512_t one;
+    uint512_mont_init(&ctx, a);
+    uint512_to_mont(&ctx, &UINT512_ONE, &one);
+    if (!is_sprp_2(&ctx, one.words)) return false;
+
+    /* Selfridge: the first of 5, -7, 9, -11, ... with (D/n) = -1, which
+       does not exist when n is a square */
+    if (uint512_is_perfect_square(a)) return false;
+    int64_t D = 5;
+    for (;;) {
+        int j = jacobi_small(D, w, limbs);
+        if (j == -1) break;
+        if (j == 0) return false;
+        D = D > 0 ? -(D + 2) : -D + 2;
+    }
+    return is_slprp(&ctx, one.words, D);
+}
+
+/* ============================================================================
+ * Batch Arithmetic
+ * ============================================================================
+ *
+ * Element-wise loops over arrays, with the argument checks hoisted out of the
+ * loop and per-element failures collected in a bitmap.  In the
+ * structure-of-arrays layout limb k of consecutive elements is contiguous,
+ * so AVX2 and AVX-512 add, subtract and compare four or eight elements per
+ * instruction; the carry from one limb plane to the next is an unsigned
+ * compare turned into a lane mask.  There is no vector 64x64-bit multiply;
+ * products of eight elements go through AVX-512 IFMA in radix 2^52 when the
+ * CPU has it and element by element through the multiplication kernels
+ * otherwise.
+ */
+
+static void batch_status_clear(uint64_t *status, size_t count) {
+    if (status) memset(status, 0, (count + 63) / 64 * sizeof(uint64_t));
+}
+
+/* Sets the status bits of elements i, i + 1, ... from the low bits of fail;
+   i is a multiple of the group size, so they share one word */
+static inline void batch_status_set(uint64_t *status, size_t i, uint64_t fail) {
+    if (fail && status) status[i / 64] |= fail << (i % 64);
+}
+
+#ifdef INT512_X86
+
+/* Products of eight elements at once with AVX-512 IFMA.  Operands are
+   converted to ten 52-bit limbs per lane; VPMADD52LUQ/HUQ add the low and
+   high halves of the 104-bit limb products into column accumulators that
+   are left unnormalized (at most twenty 52-bit terms each) and carried
+   once at the end.  Only the columns below 2^520 are formed: the product
+   overflows when a carry or a high half reaches column 10, or a nonzero
+   limb pair lies at or above it. */
+
+#define IFMA_LIMBS 10
+
+/* Transposes an 8x8 matrix of 64-bit elements held in eight registers */
+__attribute__((target("avx512f")))
+static inline __attribute__((always_inline))
+void transpose_8x8_avx512(__m512i m[8]) {
+    const __m512i lo = _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+    const __m512i hi = _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+    __m512i t[8], u[8];
+#pragma GCC unroll 4
+    for (int i = 0; i < 8; i += 2) {
+        t[i] = _mm512_unpacklo_epi64(m[i], m[i + 1]);
+        t[i + 1] = _mm512_unpackhi_epi64(m[i], m[i + 1]);
+    }
+#pragma GCC unroll 2
+    for (int i = 0; i < 8; i += 4) {
+        u[i] = _mm512_permutex2var_epi64(t[i], lo, t[i + 2]);
+        u[i + 1] = _mm512_permutex2var_epi64(t[i + 1], lo, t[i + 3]);
+        u[i + 2] = _mm512_permutex2var_epi64(t[i], hi, t[i + 2]);
+        u[i + 3] = _mm512_permutex2var_epi64(t[i + 1], hi, t[i + 3]);
+    }
+#pragma GCC unroll 4
+    for (int i = 0; i < 4; i++) {
+        m[i] = _mm512_shuffle_i64x2(u[i], u[i + 4], 0x44);
+        m[i + 4] = _mm512_shuffle_i64x2(u[i], u[i + 4], 0xee);
+    }
+}
+
+/* Eight 64-bit limb planes to ten 52-bit ones */
+__attribute__((target("avx512f")))
+static inline __attribute__((always_inline))
+void ifma_from_words(__m512i d[IFMA_LIMBS], const __m512i w[8]) {
+    const __m512i mask = _mm512_set1_epi64(((uint64_t)1 << 52) - 1);
+#pragma GCC unroll 10
+    for (int k = 0; k < IFMA_LIMBS; k++) {
+        int q = 52 * k / 64, s = 52 * k % 64;
+        __m512i x = _mm512_srli_epi64(w[q], s);
+        if (s > 12 && q < 7) x = _mm512_or_si512(x, _mm512_slli_epi64(w[q + 1], 64 - s));
+        d[k] = _mm512_and_si512(x, mask);
+    }
+}
+
+/* Ten 52-bit limb planes, normalized, to the low eight 64-bit ones */
+__attribute__((target("avx512f")))
+static inline __attribute__((always_inline))
+void ifma_to_words(__m512i w[8], const __m512i d[IFMA_LIMBS]) {
+#pragma GCC unroll 8
+    for (int q = 0; q < 8; q++) {
+        __m512i x = _mm512_setzero_si512();
+#pragma GCC unroll 10
+        for (int k = 0; k < IFMA_LIMBS; k++) {
+            int s = 52 * k - 64 * q;
+            if (s >= 0 && s < 64) x = _mm512_or_si512(x, _mm512_slli_epi64(d[k], s));
+            else if (s < 0 && s > -52) x = _mm512_or_si512(x, _mm512_srli_epi64(d[k], -s));
+        }
+        w[q] = x;
+    }
+}
+
+/* r = x * y mod 2^512 on eight lanes of 64-bit limb planes; returns the
+   lanes whose product does not fit */
+__attribute__((target("avx512f,avx512ifma")))
+static inline __attribute__((always_inline))
+__mmask8 ifma_mul_lanes(__m512i r[8], const __m512i x[8], const __m512i y[8]) {
+    const __m512i mask = _mm512_set1_epi64(((uint64_t)1 << 52) - 1);
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i a[IFMA_LIMBS], b[IFMA_LIMBS], col[IFMA_LIMBS];
+    __m512i above = zero;
+
+    ifma_from_words(a, x);
+    ifma_from_words(b, y);
+#pragma GCC unroll 10
+    for (int k = 0; k < IFMA_LIMBS; k++) col[k] = zero;
+#pragma GCC unroll 10
+    for (int i = 0; i < IFMA_LIMBS; i++) {
+#pragma GCC unroll 10
+        for (int j = 0; i + j < IFMA_LIMBS; j++) {
+            col[i + j] = _mm512_madd52lo_epu64(col[i + j], a[i], b[j]);
+            if (i + j + 1 < IFMA_LIMBS) {
+                col[i + j + 1] = _mm512_madd52hi_epu64(col[i + j + 1], a[i], b[j]);
+            } else {
+                above = _mm512_madd52hi_epu64(above, a[i], b[j]);
+            }
+        }
+    }
+
+    /* Pairs with i + j >= 10: a[i] against the OR of b[10 - i..9] */
+    __mmask8 overflow = _mm512_test_epi64_mask(above, above);
+    __m512i tail = zero;
+#pragma GCC unroll 9
+    for (int i = 1; i < IFMA_LIMBS; i++) {
+        tail = _mm512_or_si512(tail, b[IFMA_LIMBS - i]);
+        overflow |= _mm512_test_epi64_mask(a[i], a[i]) & _mm512_test_epi64_mask(tail, tail);
+    }
+
+    __m512i carry = zero;
+#pragma GCC unroll 10
+    for (int k = 0; k < IFMA_LIMBS; k++) {
+        __m512i t = _mm512_add_epi64(col[k], carry);
+        col[k] = _mm512_and_si512(t, mask);
+        carry = _mm512_srli_epi64(t, 52);
+    }
+    /* Bits 512..519 sit at the top of limb 9 */
+    overflow |= _mm512_test_epi64_mask(carry, carry);
+    overflow |= _mm512_test_epi64_mask(col[IFMA_LIMBS - 1], _mm512_set1_epi64((uint64_t)0xff << 44));
+
+    ifma_to_words(r, col);
+    return overflow;
+}
+
+/* Elements [0, count) of uint512_mul_n, count a multiple of 8; rows are
+   transposed into limb planes and back */
+__attribute__((target("avx512f,avx512ifma")))
+static uint64_t mul_n_ifma(const uint512_t *a, const uint512_t *b, uint512_t *result, size_t count,
+                           uint64_t *status) {
+    uint64_t any = 0;
+    for (size_t i = 0; i < count; i += 8) {
+        __m512i x[8], y[8], r[8];
+#pragma GCC unroll 8
+        for (int j = 0; j < 8; j++) {
+            x[j] = _mm512_loadu_si512(a[i + j].words);
+            y[j] = _mm512_loadu_si512(b[i + j].words);
+        }
+        transpose_8x8_avx512(x);
+        transpose_8x8_avx512(y);
+        __mmask8 overflow = ifma_mul_lanes(r, x, y);
+        transpose_8x8_avx512(r);
+#pragma GCC unroll 8
+        for (int j = 0; j < 8; j++) _mm512_storeu_si512(result[i + j].words, r[j]);
+        batch_status_set(status, i, overflow);
+        any |= overflow;
+    }
+    return any;
+}
+
+/* The same on limb planes, which need no transposition */
+__attribute__((target("avx512f,avx512ifma")))
+static uint64_t mul_n_soa_ifma(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                               size_t count, uint64_t *status) {
+    uint64_t any = 0;
+    for (size_t i = 0; i < count; i += 8) {
+        __m512i x[8], y[8], r[8];
+#pragma GCC unroll 8
+        for (int k = 0; k < 8; k++) {
+            x[k] = _mm512_loadu_si512(a->limbs[k] + i);
+            y[k] = _mm512_loadu_si512(b->limbs[k] + i);
+        }
+        __mmask8 overflow = ifma_mul_lanes(r, x, y);
+#pragma GCC unroll 8
+        for (int k = 0; k < 8; k++) _mm512_storeu_si512(result->limbs[k] + i, r[k]);
+        batch_status_set(status, i, overflow);
+        any |= overflow;
+    }
+    return any;
+}
+
+#endif /* INT512_X86 */
+
+int512_error_t uint512_add_n(const uint512_t *a, const uint512_t *b, uint512_t *result, size_t count,
+                             uint64_t *status) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    batch_status_clear(status, count);
+    uint64_t any = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t carry = limbs_add_8(result[i].words, a[i].words, b[i].words);
+        batch_status_set(status, i, carry);
+        any |= carry;
+    }
+    return any ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint512_sub_n(const uint512_t *a, const uint512_t *b, uint512_t *result, size_t count,
+                             uint64_t *status) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    batch_status_clear(status, count);
+    uint64_t any = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t borrow = limbs_sub_8(result[i].words, a[i].words, b[i].words);
+        batch_status_set(status, i, borrow);
+        any |= borrow;
+    }
+    return any ? INT512_ERR_UNDERFLOW : INT512_OK;
+}
+
+int512_error_t uint512_mul_n(const uint512_t *a, const uint512_t *b, uint512_t *result, size_t count,
+                             uint64_t *status) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    batch_status_clear(status, count);
+    size_t done = 0;
+    uint64_t any = 0;
+#ifdef INT512_X86
+    if (__builtin_cpu_supports("avx512ifma")) {
+        done = count & ~(size_t)7;
+        any = mul_n_ifma(a, b, result, done, status);
+    }
+#endif
+    for (size_t i = done; i < count; i++) {
+        uint64_t overflow = limbs_mul_low_8(result[i].words, a[i].words, b[i].words) != 0;
+        batch_status_set(status, i, overflow);
+        any |= overflow;
+    }
+    return any ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint512_cmp_n(const uint512_t *a, const uint512_t *b, int8_t *result, size_t count) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    for (size_t i = 0; i < count; i++) {
+        result[i] = (int8_t)limbs_cmp(a[i].words, b[i].words, 8);
+    }
+    return INT512_OK;
+}
+
+static bool soa_valid(const uint512_soa_t *s) {
+    if (!s) return false;
+    for (int k = 0; k < 8; k++) {
+        if (!s->limbs[k]) return false;
+    }
+    return true;
+}
+
+/* Elements [from, count) of an SoA sum or difference; returns nonzero if
+   any of them carried out */
+static uint64_t soa_addsub_scalar(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *r,
+                                  size_t from, size_t count, uint64_t *status, bool subtract) {
+    uint64_t any = 0;
+    for (size_t i = from; i < count; i++) {
+        uint64_t carry = 0;
+        for (int k = 0; k < 8; k++) {
+            uint64_t x = a->limbs[k][i], y = b->limbs[k][i];
+            r->limbs[k][i] = subtract ? limb_subb(x, y, carry, &carry) : limb_addc(x, y, carry, &carry);
+        }
+        batch_status_set(status, i, carry);
+        any |= carry;
+    }
+    return any;
+}
+
+static void soa_cmp_scalar(const uint512_soa_t *a, const uint512_soa_t *b, int8_t *result, size_t from,
+                           size_t count) {
+    for (size_t i = from; i < count; i++) {
+        int c = 0;
+        for (int k = 7; k >= 0 && c == 0; k--) {
+            uint64_t x = a->limbs[k][i], y = b->limbs[k][i];
+            c = (x > y) - (x < y);
+        }
+        result[i] = (int8_t)c;
+    }
+}
+
+#ifdef INT512_X86
+
+/*
+ * Four elements per step.  A lane carries out of x + y + c when the sum
+ * wraps below x, or when it is all ones before adding an incoming carry;
+ * x - y - c borrows when y > x, or when the difference is 0 before taking
+ * the incoming borrow.  Carries are kept as all-ones lanes, so adding one
+ * is subtracting the mask.  AVX2 only compares signed, so both sides are
+ * offset by 2^63 first.  count is a multiple of 4.
+ */
+__attribute__((target("avx2")))
+static uint64_t soa_addsub_avx2(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *r,
+                                size_t count, uint64_t *status, bool subtract) {
+    const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i edge = subtract ? _mm256_setzero_si256() : _mm256_set1_epi64x(-1);
+    uint64_t any = 0;
+
+    for (size_t i = 0; i < count; i += 4) {
+        __m256i carry = _mm256_setzero_si256();
+        for (int k = 0; k < 8; k++) {
+            __m256i x = _mm256_loadu_si256((const __m256i *)(a->limbs[k] + i));
+            __m256i y = _mm256_loadu_si256((const __m256i *)(b->limbs[k] + i));
+            __m256i s, out;
+            if (subtract) {
+                s = _mm256_sub_epi64(x, y);
+                out = _mm256_cmpgt_epi64(_mm256_xor_si256(y, bias), _mm256_xor_si256(x, bias));
+                out = _mm256_or_si256(out, _mm256_and_si256(carry, _mm256_cmpeq_epi64(s, edge)));
+                s = _mm256_add_epi64(s, carry);
+            } else {
+                s = _mm256_add_epi64(x, y);
+                out = _mm256_cmpgt_epi64(_mm256_xor_si256(x, bias), _mm256_xor_si256(s, bias));
+                out = _mm256_or_si256(out, _mm256_and_si256(carry, _mm256_cmpeq_epi64(s, edge)));
+                s = _mm256_sub_epi64(s, carry);
+            }
+            _mm256_storeu_si256((__m256i *)(r->limbs[k] + i), s);
+            carry = out;
+        }
+        uint64_t bits = (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(carry));
+        batch_status_set(status, i, bits);
+        any |= bits;
+    }
+    return any;
+}
+
+/* The same with eight lanes and carries in mask registers; count is a
+   multiple of 8 */
+__attribute__((target("avx512f")))
+static uint64_t soa_addsub_avx512(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *r,
+                                  size_t count, uint64_t *status, bool subtract) {
+    const __m512i one = _mm512_set1_epi64(1);
+    const __m512i edge = subtract ? _mm512_setzero_si512() : _mm512_set1_epi64(-1);
+    uint64_t any = 0;
+
+    for (size_t i = 0; i < count; i += 8) {
+        __mmask8 carry = 0;
+        for (int k = 0; k < 8; k++) {
+            __m512i x = _mm512_loadu_si512(a->limbs[k] + i);
+            __m512i y = _mm512_loadu_si512(b->limbs[k] + i);
+            __m512i s;
+            __mmask8 out;
+            if (subtract) {
+                s = _mm512_sub_epi64(x, y);
+                out = _mm512_cmplt_epu64_mask(x, y) | (carry & _mm512_cmpeq_epi64_mask(s, edge));
+                s = _mm512_mask_sub_epi64(s, carry, s, one);
+            } else {
+                s = _mm512_add_epi64(x, y);
+                out = _mm512_cmplt_epu64_mask(s, x) | (carry & _mm512_cmpeq_epi64_mask(s, edge));
+                s = _mm512_mask_add_epi64(s, carry, s, one);
+            }
+            _mm512_storeu_si512(r->limbs[k] + i, s);
+            carry = out;
+        }
+        batch_status_set(status, i, carry);
+        any |= carry;
+    }
+    return any;
+}
+
+/* Comparison from the top limb plane down: a lane is decided by the first
+   plane where it differs */
+__attribute__((target("avx2")))
+static void soa_cmp_avx2(const uint512_soa_t *a, const uint512_soa_t *b, int8_t *result, size_t count) {
+    const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+
+    for (size_t i = 0; i < count; i += 4) {
+        __m256i lt = _mm256_setzero_si256(), gt = _mm256_setzero_si256();
+        __m256i eq = _mm256_set1_epi64x(-1);
+        for (int k = 7; k >= 0; k--) {
+            __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a->limbs[k] + i)), bias);
+            __m256i y = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(b->limbs[k] + i)), bias);
+            lt = _mm256_or_si256(lt, _mm256_and_si256(eq, _mm256_cmpgt_epi64(y, x)));
+            gt = _mm256_or_si256(gt, _mm256_and_si256(eq, _mm256_cmpgt_epi64(x, y)));
+            eq = _mm256_and_si256(eq, _mm256_cmpeq_epi64(x, y));
+        }
+        int lt_bits = _mm256_movemask_pd(_mm256_castsi256_pd(lt));
+        int gt_bits = _mm256_movemask_pd(_mm256_castsi256_pd(gt));
+        for (int j = 0; j < 4; j++) {
+            result[i + j] = (int8_t)(((gt_bits >> j) & 1) - ((lt_bits >> j) & 1));
+        }
+    }
+}
+
+__attribute__((target("avx512f")))
+static void soa_cmp_avx512(const uint512_soa_t *a, const uint512_soa_t *b, int8_t *result, size_t count) {
+    for (size_t i = 0; i < count; i += 8) {
+        __mmask8 lt = 0, gt = 0, eq = 0xff;
+        for (int k = 7; k >= 0; k--) {
+            __m512i x = _mm512_loadu_si512(a->limbs[k] + i);
+            __m512i y = _mm512_loadu_si512(b->limbs[k] + i);
+            lt |= eq & _mm512_cmplt_epu64_mask(x, y);
+            gt |= eq & _mm512_cmpgt_epu64_mask(x, y);
+            eq &= _mm512_cmpeq_epi64_mask(x, y);
+        }
+        /* gt - lt per lane as -1, 0 or 1, narrowed to bytes */
+        __m512i c = _mm512_sub_epi64(_mm512_maskz_set1_epi64(gt, 1), _mm512_maskz_set1_epi64(lt, 1));
+        _mm_storel_epi64((__m128i *)(result + i), _mm512_cvtepi64_epi8(c));
+    }
+}
+
+#endif /* INT512_X86 */
+
+static int512_error_t soa_addsub(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                                 size_t count, uint64_t *status, bool subtract) {
+    if (!soa_valid(a) || !soa_valid(b) || !soa_valid(result)) return INT512_ERR_NULL_POINTER;
+
+    batch_status_clear(status, count);
+    size_t done = 0;
+    uint64_t any = 0;
+#ifdef INT512_X86
+    if (__builtin_cpu_supports("avx512f")) {
+        done = count & ~(size_t)7;
+        any = soa_addsub_avx512(a, b, result, done, status, subtract);
+    } else if (__builtin_cpu_supports("avx2")) {
+        done = count & ~(size_t)3;
+        any = soa_addsub_avx2(a, b, result, done, status, subtract);
+    }
+#endif
+    any |= soa_addsub_scalar(a, b, result, done, count, status, subtract);
+
+    if (!any) return INT512_OK;
+    return subtract ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
+}
+
+int512_error_t uint512_add_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                                 size_t count, uint64_t *status) {
+    return soa_addsub(a, b, result, count, status, false);
+}
+
+int512_error_t uint512_sub_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                                 size_t count, uint64_t *status) {
+    return soa_addsub(a, b, result, count, status, true);
+}
+
+int512_error_t uint512_mul_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                                 size_t count, uint64_t *status) {
+    if (!soa_valid(a) || !soa_valid(b) || !soa_valid(result)) return INT512_ERR_NULL_POINTER;
+
+    batch_status_clear(status, count);
+    size_t done = 0;
+    uint64_t any = 0;
+#ifdef INT512_X86
+    if (__builtin_cpu_supports("avx512ifma")) {
+        done = count & ~(size_t)7;
+        any = mul_n_soa_ifma(a, b, result, done, status);
+    }
+#endif
+    /* Eight elements at a time are transposed into whole operands, so each
+       plane is read and written a cache line at a time */
+    for (size_t i = done; i < count; i += 8) {
+        size_t m = count - i < 8 ? count - i : 8;
+        uint64_t x[8][8], y[8][8];
+        for (int k = 0; k < 8; k++) {
+            for (size_t j = 0; j < m; j++) {
+                x[j][k] = a->limbs[k][i + j];
+                y[j][k] = b->limbs[k][i + j];
+            }
+        }
+        uint64_t overflow = 0;
+        for (size_t j = 0; j < m; j++) {
+            overflow |= (uint64_t)(limbs_mul_low_8(x[j], x[j], y[j]) != 0) << j;
+        }
+        for (int k = 0; k < 8; k++) {
+            for (size_t j = 0; j < m; j++) {
+                result->limbs[k][i + j] = x[j][k];
+            }
+        }
+        batch_status_set(status, i, overflow);
+        any |= overflow;
+    }
+    return any ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t uint512_cmp_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, int8_t *result, size_t count) {
+    if (!soa_valid(a) || !soa_valid(b) || !result) return INT512_ERR_NULL_POINTER;
+
+    size_t done = 0;
+#ifdef INT512_X86
+    if (__builtin_cpu_supports("avx512f")) {
+        done = count & ~(size_t)7;
+        soa_cmp_avx512(a, b, result, done);
+    } else if (__builtin_cpu_supports("avx2")) {
+        done = count & ~(size_t)3;
+        soa_cmp_avx2(a, b, result, done);
+    }
+#endif
+    soa_cmp_scalar(a, b, result, done, count);
+    return INT512_OK;
+}
+
+/* ============================================================================
+ * Parallel Reductions
+ * ============================================================================
+ *
+ * Sums and dot products over arrays, with the errors of the sequential loop
+ * (uint512_add, int512_add, int512_mul then int512_add): the first element
+ * whose product or running sum leaves the range decides the code.  The
+ * input is cut into contiguous ranges, one per thread, and each range is
+ * accumulated exactly in limbs above the result: a sum of fewer than 2^64
+ * terms needs at most 64 bits more than its widest term.  Signed ranges also
+ * keep their least and greatest prefix sums and their first out-of-range
+ * product.  Folding the ranges left to right then shows which range holds
+ * the first error without knowing its starting sum in advance; only that
+ * range is walked again, element by element.
+ */
+
+/* Upper bound on threads per call; the tasks live on the caller's stack */
+#define REDUCE_THREADS_MAX 64
+/* Elements per thread below which starting another thread does not pay */
+#define REDUCE_MIN_CHUNK 16384
+/* Accumulator limbs: a 1024-bit product plus 64 bits of headroom */
+#define REDUCE_LIMBS 17
+
+typedef enum { REDUCE_SUM_UNSIGNED, REDUCE_SUM_SIGNED, REDUCE_DOT } reduce_kind_t;
+
+typedef struct {
+    reduce_kind_t kind;
+    const uint512_t *a;
+    const uint512_t *b;
+    size_t begin, end;
+    /* Two's complement total of the range and its least and greatest prefix
+       sums, counting the empty prefix */
+    uint64_t acc[REDUCE_LIMBS];
+    uint64_t lo[REDUCE_LIMBS];
+    uint64_t hi[REDUCE_LIMBS];
+    size_t bad;  /* first product outside the int512_t range, or end */
+} reduce_task_t;
+
+static int limbs_cmp_signed(const uint64_t *a, const uint64_t *b, int n) {
+    if (a[n - 1] != b[n - 1]) return (int64_t)a[n - 1] > (int64_t)b[n - 1] ? 1 : -1;
+    return limbs_cmp(a, b, n - 1);
+}
+
+/* Sign-extends w[0..n-1] to REDUCE_LIMBS limbs */
+static void reduce_extend(uint64_t *r, const uint64_t *w, int n) {
+    memcpy(r, w, (size_t)n * sizeof(uint64_t));
+    uint64_t sign = w[n - 1] >> 63 ? UINT64_MAX : 0;
+    for (int k = n; k < REDUCE_LIMBS; k++) r[k] = sign;
+}
+
+/* Where a REDUCE_LIMBS-limb value lies relative to the int512_t range */
+static int512_error_t reduce_classify(const uint64_t *v) {
+    uint64_t sign = v[7] >> 63 ? UINT64_MAX : 0;
+    for (int k = 8; k < REDUCE_LIMBS; k++) {
+        if (v[k] != sign) return v[REDUCE_LIMBS - 1] >> 63 ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
+    }
+    return INT512_OK;
+}
+
+static void reduce_sum_unsigned(reduce_task_t *t) {
+    uint64_t acc[9] = {0};
+    for (size_t i = t->begin; i < t->end; i++) {
+        acc[8] += limbs_add_8(acc, acc, t->a[i].words);
+    }
+    memcpy(t->acc, acc, sizeof(acc));
+    memset(t->acc + 9, 0, (REDUCE_LIMBS - 9) * sizeof(uint64_t));
+}
+
+static void reduce_sum_signed(reduce_task_t *t) {
+    /* A negative term is its 512-bit pattern minus 2^512, hence the extra
+       decrement of the headroom limb */
+    uint64_t acc[9] = {0}, lo[9] = {0}, hi[9] = {0};
+    for (size_t i = t->begin; i < t->end; i++) {
+        const uint64_t *w = t->a[i].words;
+        uint64_t negative = w[7] >> 63;
+        acc[8] += limbs_add_8(acc, acc, w) - negative;
+        if (limbs_cmp_signed(acc, hi, 9) > 0) {
+            memcpy(hi, acc, sizeof(acc));
+        } else if (limbs_cmp_signed(acc, lo, 9) < 0) {
+            memcpy(lo, acc, sizeof(acc));
+        }
+    }
+    reduce_extend(t->acc, acc, 9);
+    reduce_extend(t->lo, lo, 9);
+    reduce_extend(t->hi, hi, 9);
+    t->bad = t->end;
+}
+
+/* |x| * |y| of elements i into p; returns its limb count and sets *negative
+   to the sign of the product */
+static int reduce_product(const reduce_task_t *t, size_t i, uint64_t *p, int *negative) {
+    const uint64_t *x = t->a[i].words;
+    const uint64_t *y = t->b[i].words;
+    int512_t abs_x, abs_y;
+    *negative = 0;
+    if (x[7] >> 63) {
+        abs_x = *(const int512_t *)x;
+        int512_negate(&abs_x);
+        x = abs_x.words;
+        *negative ^= 1;
+    }
+    if (y[7] >> 63) {
+        abs_y = *(const int512_t *)y;
+        int512_negate(&abs_y);
+        y = abs_y.words;
+        *negative ^= 1;
+    }
+
+    int mx = limbs_count(x, 8);
+    int my = limbs_count(y, 8);
+    if (mx == 0 || my == 0) return 0;
+    if (mx < my) {
+        const uint64_t *swap = x;
+        x = y;
+        y = swap;
+        int m = mx;
+        mx = my;
+        my = m;
+    }
+
+    /* Near-square operands go through the full product kernels, a short y
+       row by row */
+    if (my > 4 || (my > 2 && mx <= 4)) {
+        if (mx <= 4) {
+            mul_kernels->mul_4x4(p, x, y);
+            return 8;
+        }
+        mul_kernels->mul_8x8(p, x, y);
+        return 16;
+    }
+    p[mx] = limbs_mul_1_add(p, x, mx, y[0], 0);
+    for (int j = 1; j < my; j++) {
+        p[j + mx] = limbs_addmul_1(p + j, x, mx, y[j]);
+    }
+    return mx + my;
+}
+
+/* Whether a product of magnitude p[0..n-1] fits in an int512_t */
+static bool reduce_product_fits(const uint64_t *p, int n, int negative) {
+    if (limbs_count(p, n) > 8) return false;
+    if (n < 8 || (p[7] >> 63) == 0) return true;
+    /* -2^511 is the one value of magnitude 2^511 or more */
+    return negative && p[7] == (uint64_t)1 << 63 && limbs_count(p, 7) == 0;
+}
+
+/* acc += (negative ? -p : p) over REDUCE_LIMBS limbs */
+static void reduce_accumulate(uint64_t *acc, const uint64_t *p, int n, int negative) {
+    if (negative) {
+        uint64_t borrow = limbs_sub_n(acc, acc, p, n);
+        for (int k = n; borrow && k < REDUCE_LIMBS; k++) borrow = acc[k]-- == 0;
+    } else {
+        limbs_incr(acc + n, REDUCE_LIMBS - n, limbs_add_n(acc, acc, p, n));
+    }
+}
+
+static void reduce_dot(reduce_task_t *t) {
+    uint64_t acc[REDUCE_LIMBS] = {0}, lo[REDUCE_LIMBS] = {0}, hi[REDUCE_LIMBS] = {0};
+    t->bad = t->end;
+    for (size_t i = t->begin; i < t->end; i++) {
+        uint64_t p[16];
+        int negative;
+        int n = reduce_product(t, i, p, &negative);
+        if (n == 0) continue;
+        if (t->bad == t->end && !reduce_product_fits(p, n, negative)) t->bad = i;
+        reduce_accumulate(acc, p, n, negative);
+        if (limbs_cmp_signed(acc, hi, REDUCE_LIMBS) > 0) {
+            memcpy(hi, acc, sizeof(acc));
+        } else if (limbs_cmp_signed(acc, lo, REDUCE_LIMBS) < 0) {
+            memcpy(lo, acc, sizeof(acc));
+        }
+    }
+    memcpy(t->acc, acc, sizeof(acc));
+    memcpy(t->lo, lo, sizeof(lo));
+    memcpy(t->hi, hi, sizeof(hi));
+}
+
+static void *reduce_worker(void *arg) {
+    reduce_task_t *t = arg;
+    switch (t->kind) {
+    case REDUCE_SUM_UNSIGNED: reduce_sum_unsigned(t); break;
+    case REDUCE_SUM_SIGNED: reduce_sum_signed(t); break;
+    case REDUCE_DOT: reduce_dot(t); break;
+    }
+    return NULL;
+}
+
+/* Replays range t from the running sum start, which is in range, and
+   returns the error of its first element that leaves the range */
+static int512_error_t reduce_first_error(const reduce_task_t *t, const uint64_t *start) {
+    uint64_t sum[REDUCE_LIMBS];
+    memcpy(sum, start, sizeof(sum));
+    for (size_t i = t->begin; i < t->end; i++) {
+        if (t->kind == REDUCE_DOT) {
+            uint64_t p[16];
+            int negative;
+            int n = reduce_product(t, i, p, &negative);
+            if (n == 0) continue;
+            /* int512_mul reports any product out of range as overflow */
+            if (!reduce_product_fits(p, n, negative)) return INT512_ERR_OVERFLOW;
+            reduce_accumulate(sum, p, n, negative);
+        } else {
+            uint64_t term[REDUCE_LIMBS];
+            reduce_extend(term, t->a[i].words, 8);
+            limbs_add_n(sum, sum, term, REDUCE_LIMBS);
+        }
+        int512_error_t err = reduce_classify(sum);
+        if (err != INT512_OK) return err;
+    }
+    return INT512_OK;
+}
+
+/* Threads to use for count elements when threads were requested (0 for one
+   per online processor) */
+static unsigned int reduce_threads(unsigned int threads, size_t count) {
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (unsigned int)online : 1;
+    }
+    size_t by_size = count / REDUCE_MIN_CHUNK;
+    if (threads > by_size) threads = by_size > 0 ? (unsigned int)by_size : 1;
+    if (threads > REDUCE_THREADS_MAX) threads = REDUCE_THREADS_MAX;
+    return threads;
+}
+
+/* The exact total of the reduction in total[0..REDUCE_LIMBS-1]; for the
+   signed kinds, returns the error the sequential loop would report */
+static int512_error_t reduce_run(reduce_kind_t kind, const uint512_t *a, const uint512_t *b, size_t count,
+                                 unsigned int threads, uint64_t *total) {
+    reduce_task_t tasks[REDUCE_THREADS_MAX];
+    pthread_t ids[REDUCE_THREADS_MAX];
+    bool started[REDUCE_THREADS_MAX];
+    unsigned int n = reduce_threads(threads, count);
+    size_t chunk = count / n, extra = count % n;
+
+    for (unsigned int i = 0; i < n; i++) {
+        tasks[i].kind = kind;
+        tasks[i].a = a;
+        tasks[i].b = b;
+        tasks[i].begin = i * chunk + (i < extra ? i : extra);
+        tasks[i].end = tasks[i].begin + chunk + (i < extra);
+    }
+
+    /* The caller takes the first range, and any range whose thread could
+       not be started */
+    for (unsigned int i = 1; i < n; i++) {
+        started[i] = pthread_create(&ids[i], NULL, reduce_worker, &tasks[i]) == 0;
+    }
+    reduce_worker(&tasks[0]);
+    for (unsigned int i = 1; i < n; i++) {
+        if (started[i]) {
+            pthread_join(ids[i], NULL);
+        } else {
+            reduce_worker(&tasks[i]);
+        }
+    }
+
+    /* Left to right: before the first error the running sum is in range,
+       and a range holds the first error if its extreme prefix sums, offset
+       by that sum, leave the range, or one of its products does */
+    int512_error_t err = INT512_OK;
+    memset(total, 0, REDUCE_LIMBS * sizeof(uint64_t));
+    for (unsigned int i = 0; i < n; i++) {
+        if (kind != REDUCE_SUM_UNSIGNED && err == INT512_OK) {
+            uint64_t lo[REDUCE_LIMBS], hi[REDUCE_LIMBS];
+            limbs_add_n(lo, total, tasks[i].lo, REDUCE_LIMBS);
+            limbs_add_n(hi, total, tasks[i].hi, REDUCE_LIMBS);
+            if (tasks[i].bad < tasks[i].end || reduce_classify(lo) != INT512_OK ||
+                reduce_classify(hi) != INT512_OK) {
+                err = reduce_first_error(&tasks[i], total);
+            }
+        }
+        limbs_add_n(total, total, tasks[i].acc, REDUCE_LIMBS);
+    }
+    return err;
+}
+
+int512_error_t uint512_sum_array(const uint512_t *a, size_t count, uint512_t *result, unsigned int threads) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t total[REDUCE_LIMBS];
+    reduce_run(REDUCE_SUM_UNSIGNED, a, NULL, count, threads, total);
+    memcpy(result->words, total, sizeof(result->words));
+    return limbs_count(total + 8, REDUCE_LIMBS - 8) ? INT512_ERR_OVERFLOW : INT512_OK;
+}
+
+int512_error_t int512_sum_array(const int512_t *a, size_t count, int512_t *result, unsigned int threads) {
+    if (!a || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t total[REDUCE_LIMBS];
+    int512_error_t err = reduce_run(REDUCE_SUM_SIGNED, (const uint512_t *)a, NULL, count, threads, total);
+    memcpy(result->words, total, sizeof(result->words));
+    return err;
+}
+
+int512_error_t int512_dot_array(const int512_t *a, const int512_t *b, size_t count, int512_t *result,
+                                unsigned int threads) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t total[REDUCE_LIMBS];
+    int512_error_t err = reduce_run(REDUCE_DOT, (const uint512_t *)a, (const uint512_t *)b, count, threads, total);
+    memcpy(result->words, total, sizeof(result->words));
+    return err;
+}
+
+/* ============================================================================
+ * Mixed-size Signed Operations
+ * ============================================================================ */
+
+/* Fill limb that sign-extends a b whose top limb is top */
+static uint64_t limb_sign_fill(uint64_t top) {
+    return (uint64_t)((int64_t)top >> 63);
+}
+
+static int512_error_t int512_add_small(const int512_t *a, const uint64_t *b, int bn, int512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t a_top = a->words[7];
+    uint64_t ext = limb_sign_fill(b[bn - 1]);
+    uint64_t carry = limbs_add_ext(result->words, a->words, b, bn, ext);
+
+    uint64_t sign_carry = (a_top ^ ext ^ result->words[7]) >> 63;
+    if (carry ^ sign_carry) {
+        return (a_top >> 63) ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
+    }
+
+    return INT512_OK;
+}
+
+static int512_error_t int512_sub_small(const int512_t *a, const uint64_t *b, int bn, int512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    uint64_t a_top = a->words[7];
+    uint64_t ext = limb_sign_fill(b[bn - 1]);
+    uint64_t borrow = limbs_sub_ext(result->words, a->words, b, bn, ext);
+
+    uint64_t sign_borrow = (a_top ^ ext ^ result->words[7]) >> 63;
+    if (borrow ^ sign_borrow) {
+        return (a_top >> 63) ? INT512_ERR_UNDERFLOW : INT512_ERR_OVERFLOW;
+    }
+
+    return INT512_OK;
+}
+
+/* Same overflow rules as int512_mul, with |b| taken on the one or two limbs */
+static int512_error_t int512_mul_small(const int512_t *a, const uint64_t *b, int bn, int512_t *result) {
+    if (!a || !b || !result) return INT512_ERR_NULL_POINTER;
+
+    bool negate_result = false;
+    uint64_t abs_b[2] = {b[0], bn == 2 ? b[1] : 0};
+    if (b[bn - 1] >> 63) {
+        abs_b[0] = ~abs_b[0] + 1;
+        if (bn == 2) abs_b[1] = ~abs_b[1] + (abs_b[0] == 0);
+        negate_result = true;
+    }
+
+    *result = *a;
+    if (int512_is_negative(a)) {
+        int512_negate(result);
+        negate_result = !negate_result;
+    }
+
+    uint64_t over = limbs_mul_small(result->words, result->words, abs_b, bn);
+
+    if (negate_result) {
+        int512_negate(result);
+    }
+
+    if (over) return INT512_ERR_OVERFLOW;
+    if (!negate_result && int512_is_negative(result)) return INT512_ERR_OVERFLOW;
+    if (negate_result && !int512_is_negative(result) && !int512_is_zero(result)) return INT512_ERR_OVERFLOW;
+
+    return INT512_OK;
+}
+
+int512_error_t int512_add_i8(const int512_t *a, int8_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_add_i16(const int512_t *a, int16_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_add_i32(const int512_t *a, int32_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_add_i64(const int512_t *a, int64_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_add_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_add_i128(const int512_t *a, const int64_t b[2], int512_t *result) {
+    if (!b) return INT512_ERR_NULL_POINTER;
+    uint64_t limbs[2] = {(uint64_t)b[0], (uint64_t)b[1]};
+    return int512_add_small(a, limbs, 2, result);
+}
+
+int512_error_t int512_sub_i8(const int512_t *a, int8_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_sub_i16(const int512_t *a, int16_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_sub_i32(const int512_t *a, int32_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_sub_i64(const int512_t *a, int64_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_sub_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_sub_i128(const int512_t *a, const int64_t b[2], int512_t *result) {
+    if (!b) return INT512_ERR_NULL_POINTER;
+    uint64_t limbs[2] = {(uint64_t)b[0], (uint64_t)b[1]};
+    return int512_sub_small(a, limbs, 2, result);
+}
+
+int512_error_t int512_mul_i8(const int512_t *a, int8_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_mul_i16(const int512_t *a, int16_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_mul_i32(const int512_t *a, int32_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_mul_i64(const int512_t *a, int64_t b, int512_t *result) {
+    uint64_t limb = (uint64_t)(int64_t)b;
+    return int512_mul_small(a, &limb, 1, result);
+}
+
+int512_error_t int512_mul_i128(const int512_t *a, const int64_t b[2], int512_t *result) {
+    if (!b) return INT512_ERR_NULL_POINTER;
+    uint64_t limbs[2] = {(uint64_t)b[0], (uint64_t)b[1]};
+    return int512_mul_small(a, limbs, 2, result);
+}
+
+/* Short division by a signed single limb; the remainder takes the sign of a */
+static int512_error_t int512_div_limb(const int512_t *a, int64_t b, int512_t *quotient, int64_t *remainder) {
+    if (!a || !quotient || !remainder) return INT512_ERR_NULL_POINTER;
+    if (b == 0) return INT512_ERR_DIVIDE_BY_ZERO;
+
+    bool a_neg = int512_is_negative(a);
+    bool b_neg = b < 0;
+    uint64_t b_mag = b_neg ? (uint64_t)0 - (uint64_t)b : (uint64_t)b;
+
+    int512_t abs_a = *a;
+    if (a_neg) {
+        int512_negate(&abs_a);
     }
-    return int512_mul(a, &temp, result);
-}
 
-int512_error_t int512_mul_i128(const int512_t *a, const int64_t b[2], int512_t *result) {
-    int512_t temp;
-    if (b[1] < 0) {
-        temp = (int512_t){{(uint64_t)b[0], (uint64_t)b[1], UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)b[0], (uint64_t)b[1], 0, 0, 0, 0, 0, 0}};
+    int m = limbs_count(abs_a.words, 8);
+    uint64_t rem = limbs_divrem_1(quotient->words, abs_a.words, m, b_mag);
+    for (int i = m; i < 8; i++) quotient->words[i] = 0;
+
+    if (a_neg != b_neg) {
+        int512_negate(quotient);
     }
-    return int512_mul(a, &temp, result);
+    *remainder = a_neg ? -(int64_t)rem : (int64_t)rem;
+    return INT512_OK;
 }
 
 int512_error_t int512_div_i8(const int512_t *a, int8_t b, int512_t *quotient, int8_t *remainder) {
     if (!remainder) return INT512_ERR_NULL_POINTER;
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
-    }
-    int512_t rem512;
-    int512_error_t err = int512_div(a, &temp, quotient, &rem512);
+    int64_t rem64;
+    int512_error_t err = int512_div_limb(a, b, quotient, &rem64);
     if (err == INT512_OK) {
-        *remainder = (int8_t)rem512.words[0];
+        *remainder = (int8_t)rem64;
     }
     return err;
 }
 
 int512_error_t int512_div_i16(const int512_t *a, int16_t b, int512_t *quotient, int16_t *remainder) {
     if (!remainder) return INT512_ERR_NULL_POINTER;
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
-    }
-    int512_t rem512;
-    int512_error_t err = int512_div(a, &temp, quotient, &rem512);
+    int64_t rem64;
+    int512_error_t err = int512_div_limb(a, b, quotient, &rem64);
     if (err == INT512_OK) {
-        *remainder = (int16_t)rem512.words[0];
+        *remainder = (int16_t)rem64;
     }
     return err;
 }
 
 int512_error_t int512_div_i32(const int512_t *a, int32_t b, int512_t *quotient, int32_t *remainder) {
     if (!remainder) return INT512_ERR_NULL_POINTER;
-    int512_t temp;
-    int64_t ext_b = (int64_t)b;
-    if (ext_b < 0) {
-        temp = (int512_t){{(uint64_t)ext_b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)ext_b, 0, 0, 0, 0, 0, 0, 0}};
-    }
-    int512_t rem512;
-    int512_error_t err = int512_div(a, &temp, quotient, &rem512);
+    int64_t rem64;
+    int512_error_t err = int512_div_limb(a, b, quotient, &rem64);
     if (err == INT512_OK) {
-        *remainder = (int32_t)rem512.words[0];
+        *remainder = (int32_t)rem64;
     }
     return err;
 }
 
 int512_error_t int512_div_i64(const int512_t *a, int64_t b, int512_t *quotient, int64_t *remainder) {
-    if (!remainder) return INT512_ERR_NULL_POINTER;
-    int512_t temp;
-    if (b < 0) {
-        temp = (int512_t){{(uint64_t)b, UINT64_MAX, UINT64_MAX, UINT64_MAX,
-                           UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}};
-    } else {
-        temp = (int512_t){{(uint64_t)b, 0, 0, 0, 0, 0, 0, 0}};
-    }
-    int512_t rem512;
-    int512_error_t err = int512_div(a, &temp, quotient, &rem512);
-    if (err == INT512_OK) {
-        *remainder = (int64_t)rem512.words[0];
-    }
-    return err;
+    return int512_div_limb(a, b, quotient, remainder);
 }
 
 int512_error_t int512_div_i128(const int512_t *a, const int64_t b[2], int512_t *quotient, int64_t remainder[2]) {
@@ -703,131 +4267,863 @@ int512_error_t int512_div_i128(const int512_t *a, const int64_t b[2], int512_t *
     return err;
 }
 
+/* ============================================================================
+ * Hex and Binary Codecs
+ * ============================================================================
+ *
+ * Fixed-width conversion between the 64 bytes of words[] and 128 hex or 512
+ * binary digits, most significant digit first.  The hex kernels use SSSE3 or
+ * AVX2 byte shuffles when the CPU has them, selected at run time, with a
+ * portable scalar fallback.
+ */
+
+static const char hex_lower[] = "0123456789abcdef";
+static const char hex_upper[] = "0123456789ABCDEF";
+
+/* Byte i of the big-endian image of words[] */
+static unsigned hex_byte(const uint64_t *words, int i) {
+    return (unsigned)(words[7 - i / 8] >> (56 - 8 * (i % 8))) & 0xff;
+}
+
+static void hex_encode_scalar(const uint64_t *words, char *out, const char *alphabet) {
+    for (int i = 0; i < 64; i++) {
+        unsigned b = hex_byte(words, i);
+        out[2 * i] = alphabet[b >> 4];
+        out[2 * i + 1] = alphabet[b & 0x0f];
+    }
+}
+
+/* Nibble value of a hex digit, or -1 */
+static int hex_nibble(char c) {
+    unsigned digit = (unsigned)(unsigned char)c - '0';
+    unsigned alpha = ((unsigned)(unsigned char)c | 0x20) - 'a';
+    if (digit < 10) return (int)digit;
+    if (alpha < 6) return (int)alpha + 10;
+    return -1;
+}
+
+static bool hex_decode_scalar(const char *in, uint64_t *words) {
+    int bad = 0;
+    for (int w = 0; w < 8; w++) {
+        uint64_t x = 0;
+        for (int j = 0; j < 16; j++) {
+            int nibble = hex_nibble(in[16 * (7 - w) + j]);
+            bad |= nibble;
+            x = (x << 4) | (uint64_t)(nibble & 0x0f);
+        }
+        words[w] = x;
+    }
+    return bad >= 0;
+}
+
+#ifdef INT512_X86
+
+/* Reverses the 16 bytes of each 128-bit lane */
+#define HEX_REVERSE_BYTES 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+
+__attribute__((target("ssse3")))
+static void hex_encode_ssse3(const uint64_t *words, char *out, const char *alphabet) {
+    const __m128i table = _mm_loadu_si128((const __m128i *)alphabet);
+    const __m128i low = _mm_set1_epi8(0x0f);
+    const __m128i reverse = _mm_setr_epi8(HEX_REVERSE_BYTES);
+
+    /* Two limbs per step, most significant pair first */
+    for (int i = 0; i < 4; i++) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(words + 6 - 2 * i));
+        v = _mm_shuffle_epi8(v, reverse);
+        __m128i hi = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(v, 4), low));
+        __m128i lo = _mm_shuffle_epi8(table, _mm_and_si128(v, low));
+        _mm_storeu_si128((__m128i *)(out + 32 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i *)(out + 32 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+}
+
+__attribute__((target("avx2")))
+static void hex_encode_avx2(const uint64_t *words, char *out, const char *alphabet) {
+    const __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)alphabet));
+    const __m256i low = _mm256_set1_epi8(0x0f);
+    const __m256i reverse = _mm256_setr_epi8(HEX_REVERSE_BYTES, HEX_REVERSE_BYTES);
+
+    /* Four limbs per step, most significant half first */
+    for (int i = 0; i < 2; i++) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(words + 4 - 4 * i));
+        v = _mm256_shuffle_epi8(_mm256_permute4x64_epi64(v, 0x4e), reverse);
+        __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+        __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, low));
+        __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256((__m256i *)(out + 64 * i), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + 64 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+}
+
+/* Nibble values of 16 hex digits; clears lanes of *valid holding non-digits */
+__attribute__((target("ssse3")))
+static __m128i hex_nibbles_ssse3(__m128i v, __m128i *valid) {
+    __m128i digit = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i alpha = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+    *valid = _mm_and_si128(*valid, _mm_or_si128(is_digit, is_alpha));
+    return _mm_or_si128(_mm_and_si128(is_digit, digit),
+                        _mm_andnot_si128(is_digit, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+}
+
+__attribute__((target("ssse3")))
+static bool hex_decode_ssse3(const char *in, uint64_t *words) {
+    const __m128i weights = _mm_set1_epi16(0x0110);  /* high nibble * 16 + low nibble */
+    const __m128i reverse = _mm_setr_epi8(HEX_REVERSE_BYTES);
+    __m128i valid = _mm_set1_epi8(-1);
+
+    for (int i = 0; i < 4; i++) {
+        __m128i a = hex_nibbles_ssse3(_mm_loadu_si128((const __m128i *)(in + 32 * i)), &valid);
+        __m128i b = hex_nibbles_ssse3(_mm_loadu_si128((const __m128i *)(in + 32 * i + 16)), &valid);
+        __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(a, weights), _mm_maddubs_epi16(b, weights));
+        _mm_storeu_si128((__m128i *)(words + 6 - 2 * i), _mm_shuffle_epi8(bytes, reverse));
+    }
+    return _mm_movemask_epi8(valid) == 0xffff;
+}
+
+__attribute__((target("avx2")))
+static __m256i hex_nibbles_avx2(__m256i v, __m256i *valid) {
+    __m256i digit = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+    __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+    *valid = _mm256_and_si256(*valid, _mm256_or_si256(is_digit, is_alpha));
+    return _mm256_blendv_epi8(_mm256_add_epi8(alpha, _mm256_set1_epi8(10)), digit, is_digit);
+}
+
+__attribute__((target("avx2")))
+static bool hex_decode_avx2(const char *in, uint64_t *words) {
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    const __m256i reverse = _mm256_setr_epi8(HEX_REVERSE_BYTES, HEX_REVERSE_BYTES);
+    __m256i valid = _mm256_set1_epi8(-1);
+
+    for (int i = 0; i < 2; i++) {
+        __m256i a = hex_nibbles_avx2(_mm256_loadu_si256((const __m256i *)(in + 64 * i)), &valid);
+        __m256i b = hex_nibbles_avx2(_mm256_loadu_si256((const __m256i *)(in + 64 * i + 32)), &valid);
+        /* Packing works per lane, leaving the quadwords ordered 0, 2, 1, 3;
+           reversing each lane then restoring the order reverses all 32 */
+        __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights), _mm256_maddubs_epi16(b, weights));
+        bytes = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(bytes, reverse), 0x72);
+        _mm256_storeu_si256((__m256i *)(words + 4 - 4 * i), bytes);
+    }
+    return (uint32_t)_mm256_movemask_epi8(valid) == 0xffffffffU;
+}
+
+#endif /* INT512_X86 */
+
+/* Writes 128 hex digits without a terminator */
+static void hex_encode(const uint64_t *words, char *out, bool upper) {
+    const char *alphabet = upper ? hex_upper : hex_lower;
+#ifdef INT512_X86
+    if (__builtin_cpu_supports("avx2")) {
+        hex_encode_avx2(words, out, alphabet);
+        return;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        hex_encode_ssse3(words, out, alphabet);
+        return;
+    }
+#endif
+    hex_encode_scalar(words, out, alphabet);
+}
+
+/* Reads exactly 128 hex digits of either case; false if any is invalid */
+static bool hex_decode(const char *in, uint64_t *words) {
+#ifdef INT512_X86
+    if (__builtin_cpu_supports("avx2")) return hex_decode_avx2(in, words);
+    if (__builtin_cpu_supports("ssse3")) return hex_decode_ssse3(in, words);
+#endif
+    return hex_decode_scalar(in, words);
+}
+
+/* Writes 512 binary digits, eight per byte spread across a limb (SWAR) */
+static void binary_encode(const uint64_t *words, char *out) {
+    for (int i = 0; i < 64; i++) {
+        uint64_t x = (uint64_t)hex_byte(words, i) * 0x0101010101010101ULL;
+        x &= 0x0102040810204080ULL;  /* Byte j keeps bit 7 - j */
+        x = (((x + 0x7f7f7f7f7f7f7f7fULL) >> 7) & 0x0101010101010101ULL) + 0x3030303030303030ULL;
+        x = int512_le64(x);
+        memcpy(out + 8 * i, &x, sizeof(x));
+    }
+}
+
+/* Reads exactly 512 binary digits; false if any is invalid */
+static bool binary_decode(const char *in, uint64_t *words) {
+    uint64_t bad = 0;
+    for (int w = 0; w < 8; w++) {
+        uint64_t x = 0;
+        for (int j = 0; j < 8; j++) {
+            uint64_t v;
+            memcpy(&v, in + 64 * (7 - w) + 8 * j, sizeof(v));
+            v = int512_le64(v);
+            bad |= (v & 0xfefefefefefefefeULL) ^ 0x3030303030303030ULL;
+            x = (x << 8) | (((v & 0x0101010101010101ULL) * 0x8040201008040201ULL) >> 56);
+        }
+        words[w] = x;
+    }
+    return bad == 0;
+}
+
+int512_error_t uint512_to_hex(const uint512_t *value, char *buffer, size_t buffer_size, unsigned flags) {
+    if (!value || !buffer) return INT512_ERR_NULL_POINTER;
+
+    size_t len = 128;
+    if (flags & UINT512_HEX_TRIM) {
+        int bits = limbs_bit_length(value->words, 8);
+        len = bits ? (size_t)(bits + 3) / 4 : 1;
+    }
+    if (len + 1 > buffer_size) return INT512_ERR_INVALID_STRING;
+
+    bool upper = (flags & UINT512_HEX_UPPERCASE) != 0;
+    if (len == 128) {
+        hex_encode(value->words, buffer, upper);
+    } else {
+        char hex[128];
+        hex_encode(value->words, hex, upper);
+        memcpy(buffer, hex + 128 - len, len);
+    }
+    buffer[len] = '\0';
+
+    return INT512_OK;
+}
+
+int512_error_t uint512_from_hex(const char *p, size_t len, uint512_t *result) {
+    if (!p || !result) return INT512_ERR_NULL_POINTER;
+    *result = UINT512_ZERO;
+    if (len == 0) return INT512_ERR_INVALID_STRING;
+
+    /* Digits beyond the 128 that fit must be leading zeros */
+    int512_error_t excess = INT512_OK;
+    for (; len > 128; p++, len--) {
+        int nibble = hex_nibble(*p);
+        if (nibble < 0) return INT512_ERR_INVALID_STRING;
+        if (nibble > 0) excess = INT512_ERR_OVERFLOW;
+    }
+
+    char padded[128];
+    const char *in = p;
+    if (len < 128) {
+        memset(padded, '0', 128 - len);
+        memcpy(padded + 128 - len, p, len);
+        in = padded;
+    }
+
+    uint512_t value;
+    if (!hex_decode(in, value.words)) return INT512_ERR_INVALID_STRING;
+    if (excess != INT512_OK) return excess;
+
+    *result = value;
+    return INT512_OK;
+}
+
 /* ============================================================================
  * String Conversion Functions
  * ============================================================================ */
 
+static const char radix_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+static const char decimal_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/* ceil(2^32 / log2(base)), used to bound the digit count from the bit length;
+   power-of-two bases are counted exactly and have no entry */
+static const uint32_t radix_digits_per_bit[37] = {
+    0U, 0U, 0U, 2709822658U, 0U, 1849741733U,
+    1661520156U, 1529898220U, 0U, 1354911329U, 1292913987U, 1241523976U,
+    1198050830U, 1160664036U, 1128071164U, 1099331346U, 0U, 1050766078U,
+    1029986702U, 1011073585U, 993761859U, 977836273U, 963119892U, 949465784U,
+    936750802U, 924870867U, 913737343U, 903274220U, 893415895U, 884105414U,
+    875293063U, 866935226U, 0U, 851433730U, 844225783U, 837342624U,
+    830760078U
+};
+
+/*
+ * Per-base conversion parameters.  Non-power-of-two bases are converted in
+ * chunks of chunk_digits digits, the largest power of the base that fits in
+ * a limb, so one short division peels off up to 19 decimal digits at a time.
+ * Power-of-two bases are converted by bit extraction.
+ */
+typedef struct {
+    int base;
+    int bits;                /* log2(base) for power-of-two bases, else 0 */
+    int chunk_digits;        /* Digits per chunk */
+    uint64_t chunk_base;     /* base^chunk_digits */
+    uint64_t normalized;     /* chunk_base normalized for short division */
+    uint64_t reciprocal;
+    int shift;
+    uint64_t powers[41];     /* base^i for i < chunk_digits */
+} radix_info_t;
+
+static void radix_info_init(radix_info_t *info, int base) {
+    memset(info, 0, sizeof(*info));
+    info->base = base;
+
+    if ((base & (base - 1)) == 0) {
+        info->bits = __builtin_ctz((unsigned)base);
+        return;
+    }
+
+    info->chunk_digits = 1;
+    info->chunk_base = (uint64_t)base;
+    info->powers[0] = 1;
+    while (info->chunk_base <= UINT64_MAX / (uint64_t)base) {
+        info->powers[info->chunk_digits++] = info->chunk_base;
+        info->chunk_base *= (uint64_t)base;
+    }
+    info->shift = limb_clz(info->chunk_base);
+    info->normalized = info->chunk_base << info->shift;
+    info->reciprocal = limb_reciprocal(info->normalized);
+}
+
+/* Writes the low `digits` digits of x right-to-left ending just before end */
+static void radix_put_chunk(char *end, uint64_t x, int digits, int base) {
+    if (base == 10) {
+        while (digits >= 2) {
+            uint64_t pair = x % 100;
+            x /= 100;
+            end -= 2;
+            end[0] = decimal_pairs[2 * pair];
+            end[1] = decimal_pairs[2 * pair + 1];
+            digits -= 2;
+        }
+        if (digits) *--end = (char)('0' + x % 10);
+        return;
+    }
+    while (digits-- > 0) {
+        *--end = radix_digits[x % (uint64_t)base];
+        x /= (uint64_t)base;
+    }
+}
+
+/* Number of base digits in a non-zero limb */
+static int radix_chunk_length(uint64_t x, int base) {
+    int digits = 0;
+    while (x) {
+        x /= (uint64_t)base;
+        digits++;
+    }
+    return digits;
+}
+
+/*
+ * Formats a non-zero value without a terminator.  Returns the number of
+ * characters in the representation; they are written to buffer only when
+ * that fits in buffer_size.
+ */
+static size_t radix_format(const uint512_t *value, const radix_info_t *info, char *buffer, size_t buffer_size) {
+    int m = limbs_count(value->words, 8);
+
+    if (m == 0) {
+        if (buffer_size >= 1) buffer[0] = '0';
+        return 1;
+    }
+
+    if (info->bits) {
+        int b = info->bits;
+        int total_bits = limbs_bit_length(value->words, m);
+        size_t len = (size_t)((total_bits + b - 1) / b);
+        if (len > buffer_size) return len;
+
+        if (b == 4 || b == 1) {
+            char digits[512];
+            int width = b == 4 ? 128 : 512;
+            if (b == 4) {
+                hex_encode(value->words, digits, false);
+            } else {
+                binary_encode(value->words, digits);
+            }
+            memcpy(buffer, digits + width - len, len);
+            return len;
+        }
+
+        /* Stream bits out of the limbs least significant digit first */
+        uint64_t mask = ((uint64_t)1 << b) - 1;
+        uint64_t acc = value->words[0];
+        int acc_bits = 64;
+        int word = 1;
+        char *out = buffer + len;
+        while (out > buffer) {
+            uint64_t digit;
+            if (acc_bits >= b) {
+                digit = acc;
+                acc >>= b;
+                acc_bits -= b;
+            } else {
+                uint64_t next = word < 8 ? value->words[word++] : 0;
+                digit = acc | (next << acc_bits);
+                acc = next >> (b - acc_bits);
+                acc_bits += 64 - b;
+            }
+            *--out = radix_digits[digit & mask];
+        }
+        return len;
+    }
+
+    /* Peel off chunks least significant first */
+    uint64_t num[8];
+    uint64_t chunks[16];
+    int count = 0;
+    memcpy(num, value->words, sizeof(num));
+    while (m > 0) {
+        chunks[count++] = limbs_divrem_1_preinv(num, num, m, info->normalized, info->reciprocal, info->shift);
+        m = limbs_count(num, m);
+    }
+
+    int top_digits = radix_chunk_length(chunks[count - 1], info->base);
+    size_t len = (size_t)(count - 1) * (size_t)info->chunk_digits + (size_t)top_digits;
+    if (len > buffer_size) return len;
+
+    char *end = buffer + len;
+    for (int i = 0; i < count - 1; i++) {
+        radix_put_chunk(end, chunks[i], info->chunk_digits, info->base);
+        end -= info->chunk_digits;
+    }
+    radix_put_chunk(end, chunks[count - 1], top_digits, info->base);
+    return len;
+}
+
+size_t uint512_digits_needed(const uint512_t *value, int base) {
+    if (!value || base < 2 || base > 36) return 0;
+
+    int m = limbs_count(value->words, 8);
+    if (m == 0) return 1;
+
+    uint64_t bits = (uint64_t)limbs_bit_length(value->words, m);
+    if ((base & (base - 1)) == 0) {
+        int b = __builtin_ctz((unsigned)base);
+        return (size_t)((bits + (uint64_t)b - 1) / (uint64_t)b);
+    }
+    return (size_t)((bits * radix_digits_per_bit[base]) >> 32) + 1;
+}
+
+size_t uint512_format(const uint512_t *value, char *buffer, size_t buffer_size, int base) {
+    if (!value || base < 2 || base > 36) return 0;
+    if (!buffer) buffer_size = 0;
+
+    radix_info_t info;
+    radix_info_init(&info, base);
+    return radix_format(value, &info, buffer, buffer_size);
+}
+
 int512_error_t uint512_to_string(const uint512_t *value, char *buffer, size_t buffer_size, int base) {
     if (!value || !buffer || buffer_size == 0) return INT512_ERR_NULL_POINTER;
     if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
 
-    if (uint512_is_zero(value)) {
-        if (buffer_size < 2) return INT512_ERR_INVALID_STRING;
-        buffer[0] = '0';
-        buffer[1] = '\0';
+    size_t len = uint512_format(value, buffer, buffer_size - 1, base);
+    if (len + 1 > buffer_size) return INT512_ERR_INVALID_STRING;
+    buffer[len] = '\0';
+
+    return INT512_OK;
+}
+
+/* Digit values indexed by character; 36 marks characters that are not digits */
+static const uint8_t radix_digit_table[256] = {
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 36, 36, 36, 36, 36, 36,
+    36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36
+};
+
+/* Value of a digit character, or 36 for characters that are not digits */
+static int radix_digit_value(char c) {
+    return radix_digit_table[(unsigned char)c];
+}
+
+/* Folds a chunk into the m significant limbs of r; false on overflow */
+static bool radix_fold_chunk(uint64_t *r, int *m, uint64_t mul, uint64_t chunk) {
+    uint64_t carry = limbs_mul_1_add(r, r, *m, mul, chunk);
+    if (carry == 0) return true;
+    if (*m == 8) return false;
+    r[(*m)++] = carry;
+    return true;
+}
+
+/*
+ * Eight decimal digits at a time within a limb (SWAR), after Lemire, "Fast
+ * numerical parsing".  Both helpers load 8 bytes starting at p; the first
+ * digit is the lowest byte.
+ */
+static bool swar_is_decimal8(const char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    v = int512_le64(v);
+    return ((v & 0xf0f0f0f0f0f0f0f0ULL) |
+            (((v + 0x0606060606060606ULL) & 0xf0f0f0f0f0f0f0f0ULL) >> 4)) == 0x3333333333333333ULL;
+}
+
+static uint64_t swar_parse_decimal8(const char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    v = int512_le64(v) - 0x3030303030303030ULL;
+    v = v * 10 + (v >> 8);
+    v = ((v & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32)) +
+         ((v >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32))) >> 32;
+    return (uint32_t)v;
+}
+
+/*
+ * Parses the longest prefix of p[0..len-1] made of digits in the base and
+ * stores the number of digits read in *consumed.  Fails with
+ * INT512_ERR_OVERFLOW if that prefix does not fit in 512 bits.
+ */
+static int512_error_t radix_parse(const char *p, size_t len, const radix_info_t *info,
+                                  uint512_t *result, size_t *consumed) {
+    int base = info->base;
+    *result = UINT512_ZERO;
+
+    if (info->bits) {
+        /* Power-of-two base: pack the digits' bits directly */
+        size_t n = 0;
+        while (n < len && radix_digit_value(p[n]) < base) n++;
+        *consumed = n;
+
+        size_t start = 0;
+        while (start < n && p[start] == '0') start++;
+        if (start == n) return INT512_OK;
+
+        int b = info->bits;
+        if (n - start > (size_t)(512 / b + 1)) return INT512_ERR_OVERFLOW;
+        int top = radix_digit_value(p[start]);
+        int total_bits = (int)(n - start - 1) * b + (64 - limb_clz((uint64_t)top));
+        if (total_bits > 512) return INT512_ERR_OVERFLOW;
+
+        if (b == 4 || b == 1) {
+            /* Left-pad to the fixed width of the hex or binary decoder */
+            char digits[512];
+            size_t width = b == 4 ? 128 : 512;
+            size_t count = n - start;
+            memset(digits, '0', width - count);
+            memcpy(digits + width - count, p + start, count);
+            if (b == 4) {
+                hex_decode(digits, result->words);
+            } else {
+                binary_decode(digits, result->words);
+            }
+            return INT512_OK;
+        }
+
+        /* Collect bits least significant digit first, one limb at a time */
+        uint64_t acc = 0;
+        int acc_bits = 0;
+        int word = 0;
+        for (size_t i = n; i-- > start;) {
+            uint64_t digit = (uint64_t)radix_digit_value(p[i]);
+            acc |= digit << acc_bits;
+            acc_bits += b;
+            if (acc_bits >= 64) {
+                result->words[word++] = acc;
+                acc_bits -= 64;
+                acc = acc_bits ? digit >> (b - acc_bits) : 0;
+            }
+        }
+        if (acc_bits && word < 8) result->words[word] = acc;
         return INT512_OK;
     }
 
-    char temp[600];
-    int pos = 0;
-    uint512_t num = *value;
+    /* Find the digit run first so the conversion loops below run over
+       known-valid digits with fixed trip counts */
+    size_t n = 0;
+    if (base == 10) {
+        while (n + 8 <= len && swar_is_decimal8(p + n)) n += 8;
+    }
+    while (n < len && radix_digit_value(p[n]) < base) n++;
+    *consumed = n;
+
+    size_t start = 0;
+    while (start < n && p[start] == '0') start++;
+    if (n - start > 512) return INT512_ERR_OVERFLOW;
+
+    /* Convert up to chunk_digits digits at a time in a native limb, then
+       fold each chunk in with a single multiply-by-limb pass.  The leading
+       partial chunk goes first so the rest are full. */
+    int k = info->chunk_digits;
+    int m = 0;
+    const char *digits = p + start;
+    size_t remaining = n - start;
+    size_t head = remaining % (size_t)k;
+
+    while (remaining > 0) {
+        int chunk_len = head ? (int)head : k;
+        uint64_t chunk = 0;
+        int j = 0;
+        if (base == 10) {
+            /* Odd digits first, then eight at a time */
+            for (; j < chunk_len % 8; j++) {
+                chunk = chunk * 10 + (uint64_t)(digits[j] - '0');
+            }
+            for (; j < chunk_len; j += 8) {
+                chunk = chunk * 100000000 + swar_parse_decimal8(digits + j);
+            }
+        } else {
+            for (; j < chunk_len; j++) {
+                chunk = chunk * (uint64_t)base + (uint64_t)radix_digit_value(digits[j]);
+            }
+        }
+        uint64_t scale = chunk_len == k ? info->chunk_base : info->powers[chunk_len];
+        if (!radix_fold_chunk(result->words, &m, scale, chunk)) return INT512_ERR_OVERFLOW;
+
+        digits += chunk_len;
+        remaining -= (size_t)chunk_len;
+        head = 0;
+    }
+    return INT512_OK;
+}
+
+/* Parses optional whitespace, an optional '+' and a run of digits */
+static int512_error_t uint512_parse(const char *p, size_t len, const radix_info_t *info,
+                                    size_t *consumed, uint512_t *result) {
+    *result = UINT512_ZERO;
+    *consumed = 0;
+
+    size_t i = 0;
+    while (i < len && (p[i] == ' ' || p[i] == '\t')) i++;
+
+    if (i < len && p[i] == '+') i++;
+
+    size_t digits;
+    uint512_t value;
+    int512_error_t err = radix_parse(p + i, len - i, info, &value, &digits);
+    if (digits == 0) return INT512_ERR_INVALID_STRING;
+
+    *consumed = i + digits;
+    if (err != INT512_OK) return err;
+
+    *result = value;
+    return INT512_OK;
+}
+
+/* Signed counterpart of uint512_parse, also accepting a leading '-' */
+static int512_error_t int512_parse(const char *p, size_t len, const radix_info_t *info,
+                                   size_t *consumed, int512_t *result) {
+    *consumed = 0;
 
-    while (!uint512_is_zero(&num)) {
-        uint512_t base_val = {{(uint64_t)base, 0, 0, 0, 0, 0, 0, 0}};
-        uint512_t quotient, remainder;
-        uint512_div(&num, &base_val, &quotient, &remainder);
+    size_t i = 0;
+    while (i < len && (p[i] == ' ' || p[i] == '\t')) i++;
 
-        int digit = (int)remainder.words[0];
-        temp[pos++] = (digit < 10) ? ('0' + digit) : ('a' + digit - 10);
-        num = quotient;
+    bool negative = false;
+    if (i < len && p[i] == '-') {
+        negative = true;
+        i++;
+    } else if (i < len && p[i] == '+') {
+        i++;
     }
 
-    if ((size_t)pos + 1 > buffer_size) return INT512_ERR_INVALID_STRING;
+    size_t rest;
+    int512_error_t err = uint512_parse(p + i, len - i, info, &rest, (uint512_t *)result);
+    if (rest == 0) return err;
+
+    *consumed = i + rest;
+    if (err != INT512_OK) return err;
 
-    for (int i = 0; i < pos; i++) {
-        buffer[i] = temp[pos - 1 - i];
+    if (negative) {
+        int512_negate(result);
     }
-    buffer[pos] = '\0';
 
     return INT512_OK;
 }
 
-int512_error_t uint512_from_string(const char *str, uint512_t *result, int base) {
-    if (!str || !result) return INT512_ERR_NULL_POINTER;
+int512_error_t uint512_from_chars(const char *p, size_t len, size_t *consumed, uint512_t *result, int base) {
+    if (!p || !result) return INT512_ERR_NULL_POINTER;
     if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
 
-    *result = UINT512_ZERO;
+    radix_info_t info;
+    radix_info_init(&info, base);
 
-    while (*str == ' ' || *str == '\t') str++;
+    size_t read;
+    int512_error_t err = uint512_parse(p, len, &info, &read, result);
+    if (consumed) *consumed = read;
+    return err;
+}
 
-    if (*str == '+') str++;
+int512_error_t uint512_from_string(const char *str, uint512_t *result, int base) {
+    if (!str || !result) return INT512_ERR_NULL_POINTER;
 
-    if (*str == '\0') return INT512_ERR_INVALID_STRING;
+    size_t len = strlen(str);
+    size_t consumed;
+    int512_error_t err = uint512_from_chars(str, len, &consumed, result, base);
+    if (err != INT512_OK) return err;
+    if (consumed != len) return INT512_ERR_INVALID_STRING;
 
-    uint512_t base_val = {{(uint64_t)base, 0, 0, 0, 0, 0, 0, 0}};
+    return INT512_OK;
+}
 
-    while (*str) {
-        int digit;
-        if (*str >= '0' && *str <= '9') {
-            digit = *str - '0';
-        } else if (*str >= 'a' && *str <= 'z') {
-            digit = *str - 'a' + 10;
-        } else if (*str >= 'A' && *str <= 'Z') {
-            digit = *str - 'A' + 10;
-        } else {
-            return INT512_ERR_INVALID_STRING;
-        }
+size_t int512_digits_needed(const int512_t *value, int base) {
+    if (!value) return 0;
 
-        if (digit >= base) return INT512_ERR_INVALID_STRING;
+    int512_t num = *value;
+    bool negative = int512_is_negative(value);
+    if (negative) {
+        int512_negate(&num);
+    }
 
-        uint512_t temp;
-        int512_error_t err = uint512_mul(result, &base_val, &temp);
-        if (err != INT512_OK) return err;
+    size_t digits = uint512_digits_needed((const uint512_t *)&num, base);
+    return digits ? digits + (negative ? 1 : 0) : 0;
+}
 
-        uint512_t digit_val = {{(uint64_t)digit, 0, 0, 0, 0, 0, 0, 0}};
-        err = uint512_add(&temp, &digit_val, result);
-        if (err != INT512_OK) return err;
+size_t int512_format(const int512_t *value, char *buffer, size_t buffer_size, int base) {
+    if (!value || base < 2 || base > 36) return 0;
+    if (!buffer) buffer_size = 0;
 
-        str++;
+    if (!int512_is_negative(value)) {
+        return uint512_format((const uint512_t *)value, buffer, buffer_size, base);
     }
 
-    return INT512_OK;
+    int512_t num = *value;
+    int512_negate(&num);
+
+    size_t len = uint512_format((const uint512_t *)&num, buffer_size ? buffer + 1 : buffer,
+                                buffer_size ? buffer_size - 1 : 0, base) + 1;
+    if (len <= buffer_size) buffer[0] = '-';
+    return len;
 }
 
 int512_error_t int512_to_string(const int512_t *value, char *buffer, size_t buffer_size, int base) {
     if (!value || !buffer || buffer_size == 0) return INT512_ERR_NULL_POINTER;
     if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
 
-    if (int512_is_zero(value)) {
-        if (buffer_size < 2) return INT512_ERR_INVALID_STRING;
-        buffer[0] = '0';
-        buffer[1] = '\0';
-        return INT512_OK;
-    }
+    size_t len = int512_format(value, buffer, buffer_size - 1, base);
+    if (len + 1 > buffer_size) return INT512_ERR_INVALID_STRING;
+    buffer[len] = '\0';
 
-    int offset = 0;
-    int512_t num = *value;
+    return INT512_OK;
+}
 
-    if (int512_is_negative(value)) {
-        if (buffer_size < 2) return INT512_ERR_INVALID_STRING;
-        buffer[0] = '-';
-        offset = 1;
-        int512_negate(&num);
-    }
+int512_error_t int512_from_chars(const char *p, size_t len, size_t *consumed, int512_t *result, int base) {
+    if (!p || !result) return INT512_ERR_NULL_POINTER;
+    if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
+
+    radix_info_t info;
+    radix_info_init(&info, base);
 
-    return uint512_to_string((const uint512_t *)&num, buffer + offset, buffer_size - offset, base);
+    size_t read;
+    int512_error_t err = int512_parse(p, len, &info, &read, result);
+    if (consumed) *consumed = read;
+    return err;
 }
 
 int512_error_t int512_from_string(const char *str, int512_t *result, int base) {
     if (!str || !result) return INT512_ERR_NULL_POINTER;
+
+    size_t len = strlen(str);
+    size_t consumed;
+    int512_error_t err = int512_from_chars(str, len, &consumed, result, base);
+    if (err != INT512_OK) return err;
+    if (consumed != len) return INT512_ERR_INVALID_STRING;
+
+    return INT512_OK;
+}
+
+/* ============================================================================
+ * Batch String Conversion
+ * ============================================================================ */
+
+int512_error_t uint512_to_string_batch(const uint512_t *values, size_t count, char *buffer,
+                                       size_t buffer_size, size_t *offsets, int base) {
+    if (!values || !buffer || !offsets) return INT512_ERR_NULL_POINTER;
     if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
 
-    while (*str == ' ' || *str == '\t') str++;
+    radix_info_t info;
+    radix_info_init(&info, base);
 
-    bool negative = false;
-    if (*str == '-') {
-        negative = true;
-        str++;
-    } else if (*str == '+') {
-        str++;
+    size_t pos = 0;
+    offsets[0] = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t len = radix_format(&values[i], &info, buffer + pos, buffer_size - pos);
+        if (len > buffer_size - pos) return INT512_ERR_INVALID_STRING;
+        pos += len;
+        offsets[i + 1] = pos;
     }
 
-    int512_error_t err = uint512_from_string(str, (uint512_t *)result, base);
-    if (err != INT512_OK) return err;
+    return INT512_OK;
+}
 
-    if (negative) {
-        int512_negate(result);
+int512_error_t int512_to_string_batch(const int512_t *values, size_t count, char *buffer,
+                                      size_t buffer_size, size_t *offsets, int base) {
+    if (!values || !buffer || !offsets) return INT512_ERR_NULL_POINTER;
+    if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
+
+    radix_info_t info;
+    radix_info_init(&info, base);
+
+    size_t pos = 0;
+    offsets[0] = 0;
+    for (size_t i = 0; i < count; i++) {
+        int512_t num = values[i];
+        if (int512_is_negative(&num)) {
+            if (pos == buffer_size) return INT512_ERR_INVALID_STRING;
+            buffer[pos++] = '-';
+            int512_negate(&num);
+        }
+        size_t len = radix_format((const uint512_t *)&num, &info, buffer + pos, buffer_size - pos);
+        if (len > buffer_size - pos) return INT512_ERR_INVALID_STRING;
+        pos += len;
+        offsets[i + 1] = pos;
     }
 
     return INT512_OK;
 }
+
+int512_error_t uint512_from_string_batch(const char *buffer, const size_t *offsets, size_t count,
+                                         uint512_t *results, int512_error_t *errors, int base) {
+    if (!buffer || !offsets || !results) return INT512_ERR_NULL_POINTER;
+    if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
+
+    radix_info_t info;
+    radix_info_init(&info, base);
+
+    int512_error_t first = INT512_OK;
+    for (size_t i = 0; i < count; i++) {
+        const char *field = buffer + offsets[i];
+        size_t len = offsets[i + 1] - offsets[i];
+        size_t consumed;
+
+        int512_error_t err = uint512_parse(field, len, &info, &consumed, &results[i]);
+        if (err == INT512_OK && consumed != len) err = INT512_ERR_INVALID_STRING;
+
+        if (errors) errors[i] = err;
+        if (first == INT512_OK) first = err;
+    }
+
+    return first;
+}
+
+int512_error_t int512_from_string_batch(const char *buffer, const size_t *offsets, size_t count,
+                                        int512_t *results, int512_error_t *errors, int base) {
+    if (!buffer || !offsets || !results) return INT512_ERR_NULL_POINTER;
+    if (base < 2 || base > 36) return INT512_ERR_INVALID_BASE;
+
+    radix_info_t info;
+    radix_info_init(&info, base);
+
+    int512_error_t first = INT512_OK;
+    for (size_t i = 0; i < count; i++) {
+        const char *field = buffer + offsets[i];
+        size_t len = offsets[i + 1] - offsets[i];
+        size_t consumed;
+
+        int512_error_t err = int512_parse(field, len, &info, &consumed, &results[i]);
+        if (err == INT512_OK && consumed != len) err = INT512_ERR_INVALID_STRING;
+
+        if (errors) errors[i] = err;
+        if (first == INT512_OK) first = err;
+    }
+
+    return first;
+}
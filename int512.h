@@ -15,6 +15,20 @@ typedef struct {
     uint64_t words[8];  /* Little-endian: words[0] is LSW */
 } int512_t;
 
+/* 1024-bit unsigned integer, the full product of two uint512_t */
+typedef struct {
+    uint64_t words[16];  /* Little-endian: words[0] is LSW */
+} uint1024_t;
+
+/* 2048 and 4096-bit unsigned integers */
+typedef struct {
+    uint64_t words[32];  /* Little-endian: words[0] is LSW */
+} uint2048_t;
+
+typedef struct {
+    uint64_t words[64];  /* Little-endian: words[0] is LSW */
+} uint4096_t;
+
 /* Error codes */
 typedef enum {
     INT512_OK = 0,
@@ -23,9 +37,29 @@ typedef enum {
     INT512_ERR_DIVIDE_BY_ZERO,
     INT512_ERR_INVALID_STRING,
     INT512_ERR_INVALID_BASE,
-    INT512_ERR_NULL_POINTER
+    INT512_ERR_NULL_POINTER,
+    INT512_ERR_UNSUPPORTED,
+    INT512_ERR_INVALID_MODULUS,
+    INT512_ERR_NOT_INVERTIBLE
 } int512_error_t;
 
+/*
+ * Multiplication kernel selection.  The library picks the fastest kernel the
+ * CPU supports when it is loaded (INT512_KERNEL_AUTO); forcing a specific one
+ * is mainly useful for cross-checking them.  Requesting a kernel the CPU
+ * lacks fails with INT512_ERR_UNSUPPORTED and keeps the current selection.
+ * The selection is process-wide and should not be changed while other
+ * threads are multiplying.
+ */
+typedef enum {
+    INT512_KERNEL_AUTO = 0,
+    INT512_KERNEL_PORTABLE,
+    INT512_KERNEL_MULX          /* x86-64 BMI2 + ADX */
+} int512_kernel_t;
+
+int512_error_t int512_set_kernel(int512_kernel_t kernel);
+int512_kernel_t int512_get_kernel(void);
+
 /* Constants */
 extern const uint512_t UINT512_ZERO;
 extern const uint512_t UINT512_ONE;
@@ -42,11 +76,73 @@ int512_error_t uint512_sub(const uint512_t *a, const uint512_t *b, uint512_t *re
 int512_error_t uint512_mul(const uint512_t *a, const uint512_t *b, uint512_t *result);
 int512_error_t uint512_div(const uint512_t *a, const uint512_t *b, uint512_t *quotient, uint512_t *remainder);
 
+/* Full 1024-bit product, and its upper 512 bits; neither can overflow */
+int512_error_t uint512_mul_wide(const uint512_t *a, const uint512_t *b, uint1024_t *result);
+int512_error_t uint512_mul_high(const uint512_t *a, const uint512_t *b, uint512_t *result);
+
+/*
+ * Squaring computes each cross product once, saving close to half the limb
+ * multiplies of a general multiply.  uint512_mul and int512_mul switch to it
+ * when both operands are the same object.
+ */
+int512_error_t uint512_sqr(const uint512_t *a, uint512_t *result);
+int512_error_t uint512_sqr_wide(const uint512_t *a, uint1024_t *result);
+
 /* Signed arithmetic operations */
 int512_error_t int512_add(const int512_t *a, const int512_t *b, int512_t *result);
 int512_error_t int512_sub(const int512_t *a, const int512_t *b, int512_t *result);
 int512_error_t int512_mul(const int512_t *a, const int512_t *b, int512_t *result);
 int512_error_t int512_div(const int512_t *a, const int512_t *b, int512_t *quotient, int512_t *remainder);
+int512_error_t int512_sqr(const int512_t *a, int512_t *result);
+
+/*
+ * Bit operations.  Shifts drop the bits moved past either end; shifts of 512
+ * or more give zero, or all sign bits for int512_sar.  bit_length is the
+ * position of the highest set bit plus one and ctz is 512 for zero.  Bit
+ * indices of 512 and above read as 0 and fail with INT512_ERR_OVERFLOW when
+ * written.
+ */
+int512_error_t uint512_shl(const uint512_t *a, unsigned int shift, uint512_t *result);
+int512_error_t uint512_shr(const uint512_t *a, unsigned int shift, uint512_t *result);
+int512_error_t int512_sar(const int512_t *a, unsigned int shift, int512_t *result);
+int512_error_t uint512_and(const uint512_t *a, const uint512_t *b, uint512_t *result);
+int512_error_t uint512_or(const uint512_t *a, const uint512_t *b, uint512_t *result);
+int512_error_t uint512_xor(const uint512_t *a, const uint512_t *b, uint512_t *result);
+int512_error_t uint512_not(const uint512_t *a, uint512_t *result);
+int uint512_bit_length(const uint512_t *a);
+int uint512_ctz(const uint512_t *a);
+int uint512_popcount(const uint512_t *a);
+bool uint512_test_bit(const uint512_t *a, unsigned int bit);
+int512_error_t uint512_set_bit(uint512_t *a, unsigned int bit);
+int512_error_t uint512_clear_bit(uint512_t *a, unsigned int bit);
+
+/*
+ * Wide unsigned arithmetic.  Products are built from the same 8x8 limb
+ * kernels as uint512_mul; operands of at least the Karatsuba threshold (in
+ * significant limbs) are split recursively.  The threshold is process-wide;
+ * 0 restores the default, and INT_MAX keeps every product schoolbook.
+ * Operands whose significant length is not a multiple of 16 limbs are
+ * padded to one before splitting.
+ */
+int512_error_t uint1024_add(const uint1024_t *a, const uint1024_t *b, uint1024_t *result);
+int512_error_t uint1024_sub(const uint1024_t *a, const uint1024_t *b, uint1024_t *result);
+int512_error_t uint1024_mul(const uint1024_t *a, const uint1024_t *b, uint1024_t *result);
+int512_error_t uint1024_mul_wide(const uint1024_t *a, const uint1024_t *b, uint2048_t *result);
+int uint1024_compare(const uint1024_t *a, const uint1024_t *b);
+
+int512_error_t uint2048_add(const uint2048_t *a, const uint2048_t *b, uint2048_t *result);
+int512_error_t uint2048_sub(const uint2048_t *a, const uint2048_t *b, uint2048_t *result);
+int512_error_t uint2048_mul(const uint2048_t *a, const uint2048_t *b, uint2048_t *result);
+int512_error_t uint2048_mul_wide(const uint2048_t *a, const uint2048_t *b, uint4096_t *result);
+int uint2048_compare(const uint2048_t *a, const uint2048_t *b);
+
+int512_error_t uint4096_add(const uint4096_t *a, const uint4096_t *b, uint4096_t *result);
+int512_error_t uint4096_sub(const uint4096_t *a, const uint4096_t *b, uint4096_t *result);
+int512_error_t uint4096_mul(const uint4096_t *a, const uint4096_t *b, uint4096_t *result);
+int uint4096_compare(const uint4096_t *a, const uint4096_t *b);
+
+void int512_set_karatsuba_threshold(int limbs);
+int int512_get_karatsuba_threshold(void);
 
 /* Mixed-size unsigned operations */
 int512_error_t uint512_add_u8(const uint512_t *a, uint8_t b, uint512_t *result);
@@ -73,6 +169,186 @@ int512_error_t uint512_div_u32(const uint512_t *a, uint32_t b, uint512_t *quotie
 int512_error_t uint512_div_u64(const uint512_t *a, uint64_t b, uint512_t *quotient, uint64_t *remainder);
 int512_error_t uint512_div_u128(const uint512_t *a, const uint64_t b[2], uint512_t *quotient, uint64_t remainder[2]);
 
+/* Precomputed single-limb divisor for repeated division by the same value */
+typedef struct {
+    uint64_t normalized;  /* Divisor shifted left until its top bit is set */
+    uint64_t reciprocal;  /* floor((2^128 - 1) / normalized) - 2^64 */
+    int shift;            /* Normalization shift */
+} uint512_divisor_u64_t;
+
+int512_error_t uint512_divisor_u64_init(uint512_divisor_u64_t *divisor, uint64_t d);
+int512_error_t uint512_div_u64_by(const uint512_t *a, const uint512_divisor_u64_t *divisor,
+                                  uint512_t *quotient, uint64_t *remainder);
+
+/*
+ * Precomputed divisor for repeated division by the same value.  The
+ * normalization shift and the reciprocal used for quotient digit estimation
+ * are computed once by the init functions.  A divisor prepared from an
+ * int512_t carries its sign; uint512_div_by and uint512_mod_by divide by its
+ * magnitude.
+ */
+typedef struct {
+    uint64_t normalized[8];  /* Divisor shifted left until its top bit is set */
+    uint64_t reciprocal;     /* Reciprocal of normalized[limbs - 1] */
+    int shift;               /* Normalization shift */
+    int limbs;               /* Significant limbs in the divisor */
+    bool negative;           /* Divisor sign, for int512_div_by */
+} uint512_divisor_t;
+
+int512_error_t uint512_divisor_init(uint512_divisor_t *divisor, const uint512_t *d);
+int512_error_t int512_divisor_init(uint512_divisor_t *divisor, const int512_t *d);
+int512_error_t uint512_div_by(const uint512_t *a, const uint512_divisor_t *divisor,
+                              uint512_t *quotient, uint512_t *remainder);
+int512_error_t uint512_mod_by(const uint512_t *a, const uint512_divisor_t *divisor, uint512_t *remainder);
+int512_error_t int512_div_by(const int512_t *a, const uint512_divisor_t *divisor,
+                             int512_t *quotient, int512_t *remainder);
+int512_error_t int512_mod_by(const int512_t *a, const uint512_divisor_t *divisor, int512_t *remainder);
+
+/*
+ * Montgomery context for arithmetic modulo an odd m, with R = 2^(64 limbs)
+ * taken over the significant limbs of m.  to_mont maps a to a R mod m and
+ * from_mont maps back; mont_mul and mont_sqr take operands in Montgomery
+ * form, which must be below m, and never divide.  Even moduli fail with
+ * INT512_ERR_INVALID_MODULUS.
+ */
+typedef struct {
+    uint64_t modulus[8];  /* Odd modulus m */
+    uint64_t r2[8];       /* R^2 mod m */
+    uint64_t m_inv;       /* -m^-1 mod 2^64 */
+    int limbs;            /* Significant limbs in m */
+} uint512_mont_ctx_t;
+
+int512_error_t uint512_mont_init(uint512_mont_ctx_t *ctx, const uint512_t *modulus);
+int512_error_t uint512_to_mont(const uint512_mont_ctx_t *ctx, const uint512_t *a, uint512_t *result);
+int512_error_t uint512_from_mont(const uint512_mont_ctx_t *ctx, const uint512_t *a, uint512_t *result);
+int512_error_t uint512_mont_mul(const uint512_mont_ctx_t *ctx, const uint512_t *a, const uint512_t *b,
+                                uint512_t *result);
+int512_error_t uint512_mont_sqr(const uint512_mont_ctx_t *ctx, const uint512_t *a, uint512_t *result);
+
+/*
+ * Modular exponentiation, base^exponent mod modulus.  uint512_powmod uses
+ * sliding windows over the exponent and its running time depends on the
+ * exponent, so it is meant for public exponents.  The _ct variants run a
+ * fixed 5-bit window over all 512 exponent bits, and every table lookup
+ * reads the whole table; neither the operation sequence nor the cache
+ * lines touched depend on the exponent.  They need an odd modulus
+ * (INT512_ERR_INVALID_MODULUS otherwise); uint512_powmod also accepts even
+ * moduli, using Barrett reduction.  A zero modulus fails with
+ * INT512_ERR_DIVIDE_BY_ZERO.  The mont variants reuse a prepared context.
+ */
+int512_error_t uint512_powmod(const uint512_t *base, const uint512_t *exponent, const uint512_t *modulus,
+                              uint512_t *result);
+int512_error_t uint512_powmod_ct(const uint512_t *base, const uint512_t *exponent, const uint512_t *modulus,
+                                 uint512_t *result);
+int512_error_t uint512_mont_powmod(const uint512_mont_ctx_t *ctx, const uint512_t *base,
+                                   const uint512_t *exponent, uint512_t *result);
+int512_error_t uint512_mont_powmod_ct(const uint512_mont_ctx_t *ctx, const uint512_t *base,
+                                      const uint512_t *exponent, uint512_t *result);
+
+/*
+ * Barrett context for reduction modulo any nonzero m of n significant limbs,
+ * holding mu = floor(2^(128 n) / m), which is floor(2^1024 / m) for full
+ * width moduli.  mod, mulmod and addmod reduce with multiplications only and
+ * accept operands of any size, though addmod is cheapest on residues.  The
+ * int512_t variants return the non-negative residue and so need m <= 2^511;
+ * with a larger modulus they fail with INT512_ERR_INVALID_MODULUS.  A zero
+ * modulus fails with INT512_ERR_DIVIDE_BY_ZERO.
+ */
+typedef struct {
+    uint64_t modulus[8];  /* Modulus m */
+    uint64_t mu[10];      /* floor(2^(128 limbs) / m) */
+    int limbs;            /* Significant limbs in m */
+} uint512_barrett_ctx_t;
+
+int512_error_t uint512_barrett_init(uint512_barrett_ctx_t *ctx, const uint512_t *modulus);
+int512_error_t uint512_barrett_mod(const uint512_barrett_ctx_t *ctx, const uint512_t *a, uint512_t *result);
+int512_error_t uint512_barrett_mulmod(const uint512_barrett_ctx_t *ctx, const uint512_t *a, const uint512_t *b,
+                                      uint512_t *result);
+int512_error_t uint512_barrett_addmod(const uint512_barrett_ctx_t *ctx, const uint512_t *a, const uint512_t *b,
+                                      uint512_t *result);
+int512_error_t int512_barrett_mod(const uint512_barrett_ctx_t *ctx, const int512_t *a, int512_t *result);
+int512_error_t int512_barrett_mulmod(const uint512_barrett_ctx_t *ctx, const int512_t *a, const int512_t *b,
+                                     int512_t *result);
+int512_error_t int512_barrett_addmod(const uint512_barrett_ctx_t *ctx, const int512_t *a, const int512_t *b,
+                                     int512_t *result);
+
+/*
+ * Greatest common divisor.  uint512_xgcd also returns Bezout coefficients
+ * with a x + b y = gcd, |x| <= b / 2gcd and |y| <= a / 2gcd (gcd(0, 0) is 0
+ * with x = 1, y = 0).  uint512_modinv fails with INT512_ERR_NOT_INVERTIBLE
+ * when a and the modulus share a factor.  uint512_modinv_ct runs the same
+ * operation sequence for every a and needs an odd modulus
+ * (INT512_ERR_INVALID_MODULUS otherwise); use it when a is secret.
+ */
+int512_error_t uint512_gcd(const uint512_t *a, const uint512_t *b, uint512_t *result);
+int512_error_t uint512_xgcd(const uint512_t *a, const uint512_t *b, uint512_t *gcd, int512_t *x, int512_t *y);
+int512_error_t uint512_modinv(const uint512_t *a, const uint512_t *modulus, uint512_t *result);
+int512_error_t uint512_modinv_ct(const uint512_t *a, const uint512_t *modulus, uint512_t *result);
+
+/*
+ * Integer roots.  uint512_isqrt returns floor(sqrt(a)) and, unless
+ * remainder is NULL, a - root^2.  uint512_iroot returns floor(a^(1/k)) and
+ * fails with INT512_ERR_DIVIDE_BY_ZERO for k = 0.
+ */
+int512_error_t uint512_isqrt(const uint512_t *a, uint512_t *root, uint512_t *remainder);
+int512_error_t uint512_iroot(const uint512_t *a, unsigned int k, uint512_t *result);
+bool uint512_is_perfect_square(const uint512_t *a);
+
+/*
+ * Baillie-PSW probable-prime test: trial division, then strong probable
+ * prime to base 2 and strong Lucas probable prime.  Exact below 2^64; no
+ * composite is known to pass above.
+ */
+bool uint512_is_probable_prime(const uint512_t *a);
+
+/*
+ * Element-wise arithmetic over arrays: result[i] = a[i] op b[i] for
+ * i < count, wrapping like the scalar functions.  When status is non-NULL,
+ * bit i % 64 of status[i / 64] is set if element i overflowed (add, mul) or
+ * underflowed (sub); the call returns that error if any element did.
+ * cmp_n stores uint512_compare(a[i], b[i]) in result[i].  result may alias
+ * a or b.
+ *
+ * The _soa variants take a structure-of-arrays layout of eight limb planes,
+ * which lets add, sub and cmp process four (AVX2) or eight (AVX-512)
+ * elements per instruction.  mul_n and mul_n_soa multiply eight elements at
+ * a time with AVX-512 IFMA where available.
+ */
+typedef struct {
+    uint64_t *limbs[8];  /* limbs[k][i] is limb k of element i */
+} uint512_soa_t;
+
+int512_error_t uint512_add_n(const uint512_t *a, const uint512_t *b, uint512_t *result, size_t count,
+                             uint64_t *status);
+int512_error_t uint512_sub_n(const uint512_t *a, const uint512_t *b, uint512_t *result, size_t count,
+                             uint64_t *status);
+int512_error_t uint512_mul_n(const uint512_t *a, const uint512_t *b, uint512_t *result, size_t count,
+                             uint64_t *status);
+int512_error_t uint512_cmp_n(const uint512_t *a, const uint512_t *b, int8_t *result, size_t count);
+int512_error_t uint512_add_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                                 size_t count, uint64_t *status);
+int512_error_t uint512_sub_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                                 size_t count, uint64_t *status);
+int512_error_t uint512_mul_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, const uint512_soa_t *result,
+                                 size_t count, uint64_t *status);
+int512_error_t uint512_cmp_n_soa(const uint512_soa_t *a, const uint512_soa_t *b, int8_t *result, size_t count);
+
+/*
+ * Sums and dot product over arrays, split across threads (0 for one per
+ * online processor; small arrays use fewer).  Result and error are those
+ * of the sequential loop: uint512_add or int512_add of each element (for
+ * dot, of int512_mul(a[i], b[i])) into an accumulator starting at zero.
+ * The result is the low 512 bits of the exact total, and the error is the
+ * first one that loop reports: INT512_ERR_OVERFLOW for a product out of
+ * range, or INT512_ERR_OVERFLOW or INT512_ERR_UNDERFLOW when the running
+ * sum leaves the range, even if later elements bring it back.  Neither
+ * depends on the thread count.
+ */
+int512_error_t uint512_sum_array(const uint512_t *a, size_t count, uint512_t *result, unsigned int threads);
+int512_error_t int512_sum_array(const int512_t *a, size_t count, int512_t *result, unsigned int threads);
+int512_error_t int512_dot_array(const int512_t *a, const int512_t *b, size_t count, int512_t *result,
+                                unsigned int threads);
+
 /* Mixed-size signed operations */
 int512_error_t int512_add_i8(const int512_t *a, int8_t b, int512_t *result);
 int512_error_t int512_add_i16(const int512_t *a, int16_t b, int512_t *result);
@@ -105,6 +381,62 @@ int512_error_t uint512_from_string(const char *str, uint512_t *result, int base)
 int512_error_t int512_to_string(const int512_t *value, char *buffer, size_t buffer_size, int base);
 int512_error_t int512_from_string(const char *str, int512_t *result, int base);
 
+/*
+ * Fixed-width hexadecimal codec for hashes and keys.  uint512_to_hex writes
+ * all 128 digits, most significant first, and a terminator; with
+ * UINT512_HEX_TRIM leading zeros are omitted (at least one digit is kept).
+ * uint512_from_hex reads exactly len digits of either case with no sign,
+ * prefix or whitespace.  Base 16 in the generic string functions uses the
+ * same codec.
+ */
+enum {
+    UINT512_HEX_UPPERCASE = 1,  /* Digits A-F instead of a-f */
+    UINT512_HEX_TRIM = 2        /* Omit leading zeros */
+};
+
+int512_error_t uint512_to_hex(const uint512_t *value, char *buffer, size_t buffer_size, unsigned flags);
+int512_error_t uint512_from_hex(const char *p, size_t len, uint512_t *result);
+
+/*
+ * Non-allocating formatting.  The digits_needed functions return an upper
+ * bound (at most one too large) on the characters needed to format a value,
+ * computed from its bit length.  The format functions write the exact
+ * representation without a terminator and return its length, snprintf-style:
+ * when the return value exceeds buffer_size nothing is written.  Both return
+ * 0 for a NULL value or an invalid base.
+ */
+size_t uint512_digits_needed(const uint512_t *value, int base);
+size_t int512_digits_needed(const int512_t *value, int base);
+size_t uint512_format(const uint512_t *value, char *buffer, size_t buffer_size, int base);
+size_t int512_format(const int512_t *value, char *buffer, size_t buffer_size, int base);
+
+/*
+ * Length-bounded parsing for buffers that are not NUL-terminated.  Parsing
+ * follows the from_string rules but stops at the first character that is
+ * not a digit in the base (or after len bytes) instead of rejecting it.
+ * When consumed is non-NULL it receives the number of bytes read, including
+ * leading whitespace and sign; it is 0 when no digits were found.
+ */
+int512_error_t uint512_from_chars(const char *p, size_t len, size_t *consumed, uint512_t *result, int base);
+int512_error_t int512_from_chars(const char *p, size_t len, size_t *consumed, int512_t *result, int base);
+
+/*
+ * Batch conversion over arrays.  Strings are packed without terminators into
+ * one buffer; offsets has count + 1 entries and string i occupies
+ * buffer[offsets[i]] up to buffer[offsets[i + 1]].  Formatting fails with
+ * INT512_ERR_INVALID_STRING if the buffer is too small.  Parsing converts
+ * every field, stores per-field codes in errors when it is non-NULL and
+ * returns the first error encountered.
+ */
+int512_error_t uint512_to_string_batch(const uint512_t *values, size_t count, char *buffer,
+                                       size_t buffer_size, size_t *offsets, int base);
+int512_error_t int512_to_string_batch(const int512_t *values, size_t count, char *buffer,
+                                      size_t buffer_size, size_t *offsets, int base);
+int512_error_t uint512_from_string_batch(const char *buffer, const size_t *offsets, size_t count,
+                                         uint512_t *results, int512_error_t *errors, int base);
+int512_error_t int512_from_string_batch(const char *buffer, const size_t *offsets, size_t count,
+                                        int512_t *results, int512_error_t *errors, int base);
+
 /* Utility functions */
 bool uint512_is_zero(const uint512_t *a);
 bool int512_is_zero(const int512_t *a);
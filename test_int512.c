@@ -1,7 +1,26 @@
 #include "int512.h"
 #include "ctest.h"
+#include <limits.h>
 #include <string.h>
 
+/* Deterministic LCG for the randomized tests; each test seeds it first */
+static uint64_t rng_state;
+
+static void rng_seed(uint64_t seed) {
+    rng_state = seed;
+}
+
+static uint64_t rng_next(void) {
+    rng_state = rng_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return rng_state;
+}
+
+/* Random limbs in v->words[0..limbs-1], zero above */
+static void rng_fill(uint512_t *v, int limbs) {
+    *v = UINT512_ZERO;
+    for (int i = 0; i < limbs; i++) v->words[i] = rng_next();
+}
+
 /* ============================================================================
  * Unsigned Arithmetic Tests
  * ============================================================================ */
@@ -84,6 +103,297 @@ CTEST(uint512, mul_overflow) {
     ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul(&a, &b, &result));
 }
 
+CTEST(uint512, mul_overflow_boundary) {
+    uint512_t a = {{0, 0, 0, 0, 1, 0, 0, 0}};  /* 2^256 */
+    uint512_t b = {{0, 0, 0, (uint64_t)1 << 63, 0, 0, 0, 0}};  /* 2^255 */
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_mul(&a, &b, &result));
+    ASSERT_EQUAL((uint64_t)1 << 63, result.words[7]);
+
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul(&a, &a, &result));
+    ASSERT_TRUE(uint512_is_zero(&result));
+}
+
+CTEST(uint512, mul_wide_max) {
+    uint1024_t result;
+
+    /* (2^512 - 1)^2 = 2^1024 - 2^513 + 1 */
+    ASSERT_EQUAL(INT512_OK, uint512_mul_wide(&UINT512_MAX, &UINT512_MAX, &result));
+    ASSERT_EQUAL(1ULL, result.words[0]);
+    for (int i = 1; i < 8; i++) ASSERT_EQUAL(0ULL, result.words[i]);
+    ASSERT_EQUAL(UINT64_MAX - 1, result.words[8]);
+    for (int i = 9; i < 16; i++) ASSERT_EQUAL(UINT64_MAX, result.words[i]);
+}
+
+CTEST(uint512, mul_wide_matches_mul) {
+    uint512_t a, b, low, high;
+    uint1024_t wide;
+
+    rng_seed(1);
+    rng_fill(&a, 8);
+    rng_fill(&b, 5);
+    ASSERT_EQUAL(INT512_OK, uint512_mul_wide(&a, &b, &wide));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul(&a, &b, &low));
+    ASSERT_EQUAL(INT512_OK, uint512_mul_high(&a, &b, &high));
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQUAL(wide.words[i], low.words[i]);
+        ASSERT_EQUAL(wide.words[i + 8], high.words[i]);
+    }
+    ASSERT_EQUAL(0ULL, high.words[5]);
+}
+
+CTEST(uint512, sqr_matches_mul) {
+    uint512_t a, copy, squared, product;
+    uint1024_t wide_squared, wide_product;
+
+    rng_seed(3);
+    rng_fill(&a, 4);
+    copy = a;
+    ASSERT_EQUAL(INT512_OK, uint512_sqr(&a, &squared));
+    ASSERT_EQUAL(INT512_OK, uint512_mul(&a, &copy, &product));
+    ASSERT_EQUAL(0, uint512_compare(&product, &squared));
+
+    a.words[6] = rng_next();
+    copy = a;
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_sqr(&a, &squared));
+    ASSERT_EQUAL(INT512_OK, uint512_sqr_wide(&a, &wide_squared));
+    ASSERT_EQUAL(INT512_OK, uint512_mul_wide(&a, &copy, &wide_product));
+    for (int i = 0; i < 16; i++) ASSERT_EQUAL(wide_product.words[i], wide_squared.words[i]);
+    for (int i = 0; i < 8; i++) ASSERT_EQUAL(wide_product.words[i], squared.words[i]);
+}
+
+CTEST(uint512, sqr_max) {
+    uint1024_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_sqr_wide(&UINT512_MAX, &result));
+    ASSERT_EQUAL(1ULL, result.words[0]);
+    ASSERT_EQUAL(UINT64_MAX - 1, result.words[8]);
+    ASSERT_EQUAL(UINT64_MAX, result.words[15]);
+}
+
+CTEST(kernel, select_portable) {
+    ASSERT_EQUAL(INT512_OK, int512_set_kernel(INT512_KERNEL_PORTABLE));
+    ASSERT_EQUAL(INT512_KERNEL_PORTABLE, int512_get_kernel());
+    ASSERT_EQUAL(INT512_OK, int512_set_kernel(INT512_KERNEL_AUTO));
+}
+
+/* Products of every kernel must match the portable ones bit for bit */
+CTEST(kernel, mulx_matches_portable) {
+    if (int512_set_kernel(INT512_KERNEL_MULX) != INT512_OK) {
+        ASSERT_EQUAL(INT512_KERNEL_PORTABLE, int512_get_kernel());
+        return;
+    }
+
+    rng_seed(0x9e3779b97f4a7c15ULL);
+    for (int iter = 0; iter < 2000; iter++) {
+        uint512_t a, b;
+        int limbs_a = 1 + iter % 8, limbs_b = 1 + (iter / 8) % 8;
+        rng_fill(&a, limbs_a);
+        rng_fill(&b, limbs_b);
+        for (int i = 0; i < limbs_a && iter % 5 == 0; i++) a.words[i] = UINT64_MAX;
+        for (int i = 0; i < limbs_b && iter % 7 == 0; i++) b.words[i] = UINT64_MAX;
+
+        uint512_t low[2], batch[2], square[2];
+        uint1024_t wide[2], wide_square[2];
+        int512_error_t err[2], batch_err[2], square_err[2];
+        for (int k = 0; k < 2; k++) {
+            int512_set_kernel(k ? INT512_KERNEL_MULX : INT512_KERNEL_PORTABLE);
+            err[k] = uint512_mul(&a, &b, &low[k]);
+            batch_err[k] = uint512_mul_n(&a, &b, &batch[k], 1, NULL);
+            square_err[k] = uint512_sqr(&a, &square[k]);
+            uint512_mul_wide(&a, &b, &wide[k]);
+            uint512_sqr_wide(&a, &wide_square[k]);
+        }
+
+        ASSERT_EQUAL(err[0], err[1]);
+        ASSERT_EQUAL(err[0], batch_err[1]);
+        ASSERT_EQUAL(square_err[0], square_err[1]);
+        ASSERT_DATA((const unsigned char *)&low[0], sizeof(uint512_t), (const unsigned char *)&low[1], sizeof(uint512_t));
+        ASSERT_DATA((const unsigned char *)&low[0], sizeof(uint512_t), (const unsigned char *)&batch[1], sizeof(uint512_t));
+        ASSERT_DATA((const unsigned char *)&square[0], sizeof(uint512_t),
+                    (const unsigned char *)&square[1], sizeof(uint512_t));
+        ASSERT_DATA((const unsigned char *)&wide[0], sizeof(uint1024_t),
+                    (const unsigned char *)&wide[1], sizeof(uint1024_t));
+        ASSERT_DATA((const unsigned char *)&wide_square[0], sizeof(uint1024_t),
+                    (const unsigned char *)&wide_square[1], sizeof(uint1024_t));
+    }
+
+    /* Truncated products at the 2^512 boundary: 8 + 1 limbs fit unless
+       the low columns carry out, 8 + 2 limbs never fit */
+    uint512_t top = UINT512_ZERO, two = UINT512_ZERO, limb = UINT512_ZERO, r;
+    top.words[7] = 1ULL << 63;
+    two.words[0] = 2;
+    limb.words[1] = 1;
+    for (int k = 0; k < 2; k++) {
+        int512_set_kernel(k ? INT512_KERNEL_MULX : INT512_KERNEL_PORTABLE);
+        ASSERT_EQUAL(INT512_OK, uint512_mul(&UINT512_MAX, &UINT512_ONE, &r));
+        ASSERT_EQUAL(0, uint512_compare(&UINT512_MAX, &r));
+        ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul(&top, &two, &r));
+        ASSERT_EQUAL(0, uint512_compare(&UINT512_ZERO, &r));
+        ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul(&top, &limb, &r));
+        ASSERT_EQUAL(0, uint512_compare(&UINT512_ZERO, &r));
+    }
+
+    int512_set_kernel(INT512_KERNEL_AUTO);
+}
+
+/* ============================================================================
+ * Bit Operation Tests
+ * ============================================================================ */
+
+CTEST(bits, shifts) {
+    uint512_t a = {{0x8000000000000001ULL, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_shl(&a, 1, &result));
+    ASSERT_EQUAL(2ULL, result.words[0]);
+    ASSERT_EQUAL(1ULL, result.words[1]);
+
+    /* A whole-limb move plus a funnel across the boundary */
+    ASSERT_EQUAL(INT512_OK, uint512_shl(&a, 3 * 64 + 4, &result));
+    ASSERT_EQUAL(0ULL, result.words[2]);
+    ASSERT_EQUAL(0x10ULL, result.words[3]);
+    ASSERT_EQUAL(8ULL, result.words[4]);
+    ASSERT_EQUAL(INT512_OK, uint512_shr(&result, 3 * 64 + 4, &result));
+    ASSERT_EQUAL(0, uint512_compare(&a, &result));
+
+    ASSERT_EQUAL(INT512_OK, uint512_shl(&UINT512_MAX, 511, &result));
+    ASSERT_EQUAL(0x8000000000000000ULL, result.words[7]);
+    ASSERT_EQUAL(0ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_shr(&UINT512_MAX, 512, &result));
+    ASSERT_TRUE(uint512_is_zero(&result));
+
+    /* -2^511 >> 100 = -2^411; -1 stays -1 however far it is shifted */
+    int512_t signed_result;
+    ASSERT_EQUAL(INT512_OK, int512_sar(&INT512_MIN, 100, &signed_result));
+    ASSERT_EQUAL(UINT64_MAX << 27, signed_result.words[6]);
+    ASSERT_EQUAL(UINT64_MAX, signed_result.words[7]);
+    ASSERT_EQUAL(0ULL, signed_result.words[5]);
+    int512_t minus_one;
+    ASSERT_EQUAL(INT512_OK, int512_sub(&INT512_ZERO, &INT512_ONE, &minus_one));
+    ASSERT_EQUAL(INT512_OK, int512_sar(&minus_one, 1000, &signed_result));
+    ASSERT_EQUAL(0, int512_compare(&minus_one, &signed_result));
+    ASSERT_EQUAL(INT512_OK, int512_sar(&INT512_MAX, 510, &signed_result));
+    ASSERT_EQUAL(0, int512_compare(&INT512_ONE, &signed_result));
+}
+
+CTEST(bits, bitwise) {
+    uint512_t a = {{0xff00ff00ff00ff00ULL, 0, UINT64_MAX, 0, 0, 0, 0, 1}};
+    uint512_t b = {{0x0ff00ff00ff00ff0ULL, UINT64_MAX, 0, 0, 0, 0, 0, 1}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_and(&a, &b, &result));
+    ASSERT_EQUAL(0x0f000f000f000f00ULL, result.words[0]);
+    ASSERT_EQUAL(0ULL, result.words[1]);
+    ASSERT_EQUAL(1ULL, result.words[7]);
+    ASSERT_EQUAL(INT512_OK, uint512_or(&a, &b, &result));
+    ASSERT_EQUAL(0xfff0fff0fff0fff0ULL, result.words[0]);
+    ASSERT_EQUAL(UINT64_MAX, result.words[1]);
+    ASSERT_EQUAL(INT512_OK, uint512_xor(&a, &b, &result));
+    ASSERT_EQUAL(0xf0f0f0f0f0f0f0f0ULL, result.words[0]);
+    ASSERT_EQUAL(0ULL, result.words[7]);
+    ASSERT_EQUAL(INT512_OK, uint512_not(&UINT512_ONE, &result));
+    ASSERT_EQUAL(UINT64_MAX - 1, result.words[0]);
+    ASSERT_EQUAL(UINT64_MAX, result.words[7]);
+    ASSERT_EQUAL(INT512_ERR_NULL_POINTER, uint512_and(NULL, &b, &result));
+}
+
+CTEST(bits, counting) {
+    uint512_t a = {{0, 0, 0x10, 0, 0, 0xf0, 0, 0}};
+
+    ASSERT_EQUAL(5 * 64 + 8, uint512_bit_length(&a));
+    ASSERT_EQUAL(2 * 64 + 4, uint512_ctz(&a));
+    ASSERT_EQUAL(5, uint512_popcount(&a));
+    ASSERT_EQUAL(0, uint512_bit_length(&UINT512_ZERO));
+    ASSERT_EQUAL(512, uint512_ctz(&UINT512_ZERO));
+    ASSERT_EQUAL(512, uint512_bit_length(&UINT512_MAX));
+    ASSERT_EQUAL(512, uint512_popcount(&UINT512_MAX));
+
+    ASSERT_TRUE(uint512_test_bit(&a, 132));
+    ASSERT_FALSE(uint512_test_bit(&a, 131));
+    ASSERT_FALSE(uint512_test_bit(&UINT512_MAX, 512));
+
+    ASSERT_EQUAL(INT512_OK, uint512_set_bit(&a, 511));
+    ASSERT_EQUAL(0x8000000000000000ULL, a.words[7]);
+    ASSERT_EQUAL(INT512_OK, uint512_clear_bit(&a, 132));
+    ASSERT_EQUAL(0ULL, a.words[2]);
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_set_bit(&a, 512));
+}
+
+/* ============================================================================
+ * Wide Unsigned Arithmetic Tests
+ * ============================================================================ */
+
+CTEST(wide, add_sub_carry) {
+    uint1024_t a, one, result;
+    memset(&a, 0xff, sizeof(a));
+    memset(&one, 0, sizeof(one));
+    one.words[0] = 1;
+
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint1024_add(&a, &one, &result));
+    for (int i = 0; i < 16; i++) ASSERT_EQUAL(0ULL, result.words[i]);
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, uint1024_sub(&result, &one, &result));
+    ASSERT_EQUAL(0, uint1024_compare(&a, &result));
+}
+
+CTEST(wide, mul_wide_max) {
+    /* (2^2048 - 1)^2 = 2^4096 - 2^2049 + 1 */
+    static uint2048_t max;
+    static uint4096_t square;
+    memset(&max, 0xff, sizeof(max));
+
+    int thresholds[] = {16, INT_MAX, 0};
+    for (size_t t = 0; t < sizeof(thresholds) / sizeof(thresholds[0]); t++) {
+        int512_set_karatsuba_threshold(thresholds[t]);
+        ASSERT_EQUAL(INT512_OK, uint2048_mul_wide(&max, &max, &square));
+        ASSERT_EQUAL(1ULL, square.words[0]);
+        for (int i = 1; i < 32; i++) ASSERT_EQUAL(0ULL, square.words[i]);
+        ASSERT_EQUAL(UINT64_MAX - 1, square.words[32]);
+        for (int i = 33; i < 64; i++) ASSERT_EQUAL(UINT64_MAX, square.words[i]);
+    }
+}
+
+CTEST(wide, karatsuba_matches_schoolbook) {
+    static uint4096_t a, b, expected, result;
+    rng_seed(0x9e3779b97f4a7c15ULL);
+
+    for (int iter = 0; iter < 64; iter++) {
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        int limbs_a = 1 + (iter * 7) % 64, limbs_b = 1 + (iter * 13) % 64;
+        for (int i = 0; i < limbs_a; i++) a.words[i] = (iter % 5 == 0) ? UINT64_MAX : rng_next();
+        for (int i = 0; i < limbs_b; i++) b.words[i] = (iter % 3 == 0) ? UINT64_MAX : rng_next();
+
+        int512_set_karatsuba_threshold(INT_MAX);
+        int512_error_t expected_err = uint4096_mul(&a, &b, &expected);
+        int512_set_karatsuba_threshold(16);
+        ASSERT_EQUAL(expected_err, uint4096_mul(&a, &b, &result));
+        ASSERT_EQUAL(0, uint4096_compare(&expected, &result));
+        if (limbs_a + limbs_b != 65) {
+            ASSERT_EQUAL(limbs_a + limbs_b > 65 ? INT512_ERR_OVERFLOW : INT512_OK, expected_err);
+        }
+    }
+    int512_set_karatsuba_threshold(0);
+}
+
+CTEST(wide, mul_wide_matches_uint512) {
+    uint512_t a = {{UINT64_MAX, 3, 0, 0x0123456789abcdefULL, 5, 6, 7, UINT64_MAX}};
+    uint512_t b = {{11, UINT64_MAX, 13, 14, 0, 16, UINT64_MAX, 18}};
+    uint1024_t wa, wb, expected;
+    uint2048_t result;
+
+    memset(&wa, 0, sizeof(wa));
+    memset(&wb, 0, sizeof(wb));
+    memcpy(wa.words, a.words, sizeof(a.words));
+    memcpy(wb.words, b.words, sizeof(b.words));
+    ASSERT_EQUAL(INT512_OK, uint512_mul_wide(&a, &b, &expected));
+    ASSERT_EQUAL(INT512_OK, uint1024_mul_wide(&wa, &wb, &result));
+    ASSERT_DATA((const unsigned char *)expected.words, sizeof(expected.words),
+                (const unsigned char *)result.words, sizeof(expected.words));
+    for (int i = 16; i < 32; i++) ASSERT_EQUAL(0ULL, result.words[i]);
+}
+
 CTEST(uint512, div_simple) {
     uint512_t a = {{100, 0, 0, 0, 0, 0, 0, 0}};
     uint512_t b = {{10, 0, 0, 0, 0, 0, 0, 0}};
@@ -111,6 +421,61 @@ CTEST(uint512, div_by_zero) {
     ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_div(&a, &UINT512_ZERO, &quotient, &remainder));
 }
 
+CTEST(uint512, div_multi_limb) {
+    /* (2^128 + 5) * (2^64 + 7) + 3 */
+    uint512_t a = {{38, 5, 7, 1, 0, 0, 0, 0}};
+    uint512_t b = {{7, 1, 0, 0, 0, 0, 0, 0}};
+    uint512_t quotient, remainder;
+
+    ASSERT_EQUAL(INT512_OK, uint512_div(&a, &b, &quotient, &remainder));
+    ASSERT_EQUAL(5ULL, quotient.words[0]);
+    ASSERT_EQUAL(0ULL, quotient.words[1]);
+    ASSERT_EQUAL(1ULL, quotient.words[2]);
+    ASSERT_EQUAL(3ULL, remainder.words[0]);
+    ASSERT_EQUAL(0ULL, remainder.words[1]);
+}
+
+CTEST(uint512, div_max_by_max) {
+    uint512_t quotient, remainder;
+
+    ASSERT_EQUAL(INT512_OK, uint512_div(&UINT512_MAX, &UINT512_MAX, &quotient, &remainder));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &quotient));
+    ASSERT_TRUE(uint512_is_zero(&remainder));
+}
+
+CTEST(uint512, div_quotient_aliases_dividend) {
+    uint512_t a = {{100, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t b = {{7, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t remainder;
+
+    ASSERT_EQUAL(INT512_OK, uint512_div(&a, &b, &a, &remainder));
+    ASSERT_EQUAL(14ULL, a.words[0]);
+    ASSERT_EQUAL(2ULL, remainder.words[0]);
+}
+
+CTEST(uint512, div_identity_all_sizes) {
+    /* Check a == q * b + r and r < b for divisors of every limb count,
+       including normalized top limbs that force quotient corrections. */
+    rng_seed(0x0123456789abcdefULL);
+    for (int iter = 0; iter < 400; iter++) {
+        uint512_t a, b, quotient, remainder, check;
+        int limbs = iter % 8 + 1;
+        rng_fill(&a, 8);
+        rng_fill(&b, limbs);
+        if (iter % 3 == 0) {
+            b.words[limbs - 1] = (uint64_t)1 << 63;
+            for (int i = 0; i < limbs - 1; i++) b.words[i] = UINT64_MAX;
+        }
+        if (b.words[limbs - 1] == 0) b.words[limbs - 1] = 1;
+
+        ASSERT_EQUAL(INT512_OK, uint512_div(&a, &b, &quotient, &remainder));
+        ASSERT_EQUAL(-1, uint512_compare(&remainder, &b));
+        ASSERT_EQUAL(INT512_OK, uint512_mul(&quotient, &b, &check));
+        ASSERT_EQUAL(INT512_OK, uint512_add(&check, &remainder, &check));
+        ASSERT_EQUAL(0, uint512_compare(&a, &check));
+    }
+}
+
 /* ============================================================================
  * Signed Arithmetic Tests
  * ============================================================================ */
@@ -140,6 +505,29 @@ CTEST(int512, add_overflow_positive) {
     ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_add(&INT512_MAX, &INT512_ONE, &result));
 }
 
+CTEST(int512, add_sub_sign_boundaries) {
+    int512_t minus_one, result;
+    memset(&minus_one, 0xff, sizeof(minus_one));
+
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, int512_add(&INT512_MIN, &minus_one, &result));
+    ASSERT_EQUAL(INT512_OK, int512_add(&INT512_MAX, &INT512_MIN, &result));
+    ASSERT_EQUAL(0, int512_compare(&minus_one, &result));
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, int512_sub(&INT512_MIN, &INT512_ONE, &result));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_sub(&INT512_MAX, &minus_one, &result));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_sub(&INT512_ZERO, &INT512_MIN, &result));
+    ASSERT_EQUAL(INT512_OK, int512_sub(&minus_one, &INT512_MIN, &result));
+    ASSERT_EQUAL(0, int512_compare(&INT512_MAX, &result));
+}
+
+CTEST(int512, add_in_place) {
+    int512_t a = INT512_MAX;
+
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_add(&a, &INT512_ONE, &a));
+    ASSERT_EQUAL(0, int512_compare(&INT512_MIN, &a));
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, int512_sub(&a, &INT512_ONE, &a));
+    ASSERT_EQUAL(0, int512_compare(&INT512_MAX, &a));
+}
+
 CTEST(int512, sub_positive) {
     int512_t a = {{100, 0, 0, 0, 0, 0, 0, 0}};
     int512_t b = {{50, 0, 0, 0, 0, 0, 0, 0}};
@@ -171,6 +559,30 @@ CTEST(int512, mul_negative) {
     ASSERT_TRUE(int512_is_negative(&result));
 }
 
+CTEST(int512, sqr_negative) {
+    int512_t a = {{0, 0, 0, 0, 0, 0, 0, 0}};
+    int512_t result;
+
+    ASSERT_EQUAL(INT512_OK, int512_from_string("-123456789012345678901234567890", &a, 10));
+    ASSERT_EQUAL(INT512_OK, int512_sqr(&a, &result));
+
+    char buffer[200];
+    ASSERT_EQUAL(INT512_OK, int512_to_string(&result, buffer, sizeof(buffer), 10));
+    ASSERT_STR("15241578753238836750495351562536198787501905199875019052100", buffer);
+}
+
+CTEST(int512, sqr_overflow) {
+    int512_t a = {{0, 0, 0, (uint64_t)1 << 63, 0, 0, 0, 0}};  /* 2^255 */
+    int512_t result;
+
+    ASSERT_EQUAL(INT512_OK, int512_sqr(&a, &result));
+    ASSERT_EQUAL((uint64_t)1 << 62, result.words[7]);
+
+    a.words[4] = 1;
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_sqr(&a, &result));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_sqr(&INT512_MIN, &result));
+}
+
 CTEST(int512, div_positive) {
     int512_t a = {{100, 0, 0, 0, 0, 0, 0, 0}};
     int512_t b = {{10, 0, 0, 0, 0, 0, 0, 0}};
@@ -188,6 +600,820 @@ CTEST(int512, div_by_zero) {
     ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, int512_div(&a, &INT512_ZERO, &quotient, &remainder));
 }
 
+/* ============================================================================
+ * Precomputed Divisor Tests
+ * ============================================================================ */
+
+CTEST(divisor, init_zero) {
+    uint512_divisor_t divisor;
+
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_divisor_init(&divisor, &UINT512_ZERO));
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, int512_divisor_init(&divisor, &INT512_ZERO));
+}
+
+CTEST(divisor, uint512_matches_div) {
+    rng_seed(0xfedcba9876543210ULL);
+    for (int limbs = 1; limbs <= 8; limbs++) {
+        uint512_t d;
+        rng_fill(&d, limbs);
+        d.words[limbs - 1] >>= 7 * limbs;
+        if (d.words[limbs - 1] == 0) d.words[limbs - 1] = 1;
+
+        uint512_divisor_t divisor;
+        ASSERT_EQUAL(INT512_OK, uint512_divisor_init(&divisor, &d));
+
+        for (int iter = 0; iter < 20; iter++) {
+            uint512_t a, expected_q, expected_r, quotient, remainder, modulus;
+            rng_fill(&a, 8 - iter % 8);
+
+            ASSERT_EQUAL(INT512_OK, uint512_div(&a, &d, &expected_q, &expected_r));
+            ASSERT_EQUAL(INT512_OK, uint512_div_by(&a, &divisor, &quotient, &remainder));
+            ASSERT_EQUAL(INT512_OK, uint512_mod_by(&a, &divisor, &modulus));
+            ASSERT_EQUAL(0, uint512_compare(&expected_q, &quotient));
+            ASSERT_EQUAL(0, uint512_compare(&expected_r, &remainder));
+            ASSERT_EQUAL(0, uint512_compare(&expected_r, &modulus));
+        }
+    }
+}
+
+CTEST(divisor, int512_signs) {
+    int512_t a = {{100, 0, 0, 0, 0, 0, 0, 0}};
+    int512_t d = {{7, 0, 0, 0, 0, 0, 0, 0}};
+    int512_t neg_a = INT512_ZERO, neg_d = INT512_ZERO;
+    int512_sub(&neg_a, &a, &neg_a);
+    int512_sub(&neg_d, &d, &neg_d);
+
+    const int512_t *dividends[] = {&a, &neg_a};
+    const int512_t *divisors[] = {&d, &neg_d};
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 2; j++) {
+            uint512_divisor_t divisor;
+            int512_t expected_q, expected_r, quotient, remainder, modulus;
+
+            ASSERT_EQUAL(INT512_OK, int512_divisor_init(&divisor, divisors[j]));
+            ASSERT_EQUAL(INT512_OK, int512_div(dividends[i], divisors[j], &expected_q, &expected_r));
+            ASSERT_EQUAL(INT512_OK, int512_div_by(dividends[i], &divisor, &quotient, &remainder));
+            ASSERT_EQUAL(INT512_OK, int512_mod_by(dividends[i], &divisor, &modulus));
+            ASSERT_EQUAL(0, int512_compare(&expected_q, &quotient));
+            ASSERT_EQUAL(0, int512_compare(&expected_r, &remainder));
+            ASSERT_EQUAL(0, int512_compare(&expected_r, &modulus));
+        }
+    }
+}
+
+/* ============================================================================
+ * Montgomery Arithmetic Tests
+ * ============================================================================ */
+
+CTEST(mont, init_rejects_even) {
+    uint512_mont_ctx_t ctx;
+    uint512_t even = {{10, 0, 0, 0, 0, 0, 0, 1}};
+
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, uint512_mont_init(&ctx, &even));
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, uint512_mont_init(&ctx, &UINT512_ZERO));
+    ASSERT_EQUAL(INT512_ERR_NULL_POINTER, uint512_mont_init(NULL, &UINT512_ONE));
+}
+
+CTEST(mont, mul_matches_mul_div) {
+    /* 2^255 - 19 (4 limbs, unrolled path) and 2^192 - 2^64 - 1 (3 limbs) */
+    uint512_t moduli[] = {
+        {{UINT64_MAX - 18, UINT64_MAX, UINT64_MAX, UINT64_MAX >> 1, 0, 0, 0, 0}},
+        {{UINT64_MAX, UINT64_MAX - 1, UINT64_MAX, 0, 0, 0, 0, 0}},
+    };
+    uint512_t a = {{0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x1111111111111111ULL, 7, 0, 0, 0, 0}};
+    uint512_t b = {{UINT64_MAX, 3, 0x8000000000000000ULL, 0x2222222222222222ULL, 0, 0, 0, 0}};
+
+    for (size_t i = 0; i < sizeof(moduli) / sizeof(moduli[0]); i++) {
+        uint512_mont_ctx_t ctx;
+        uint512_t am, bm, product, square, expected, q, r;
+
+        ASSERT_EQUAL(INT512_OK, uint512_mont_init(&ctx, &moduli[i]));
+        ASSERT_EQUAL(INT512_OK, uint512_to_mont(&ctx, &a, &am));
+        ASSERT_EQUAL(INT512_OK, uint512_to_mont(&ctx, &b, &bm));
+        ASSERT_EQUAL(INT512_OK, uint512_mont_mul(&ctx, &am, &bm, &product));
+        ASSERT_EQUAL(INT512_OK, uint512_from_mont(&ctx, &product, &product));
+
+        ASSERT_EQUAL(INT512_OK, uint512_div(&a, &moduli[i], &q, &r));
+        ASSERT_EQUAL(INT512_OK, uint512_div(&b, &moduli[i], &q, &expected));
+        ASSERT_EQUAL(INT512_OK, uint512_mul(&r, &expected, &expected));
+        ASSERT_EQUAL(INT512_OK, uint512_div(&expected, &moduli[i], &q, &expected));
+        ASSERT_EQUAL(0, uint512_compare(&expected, &product));
+
+        ASSERT_EQUAL(INT512_OK, uint512_mont_sqr(&ctx, &am, &square));
+        ASSERT_EQUAL(INT512_OK, uint512_mont_mul(&ctx, &am, &am, &product));
+        ASSERT_EQUAL(0, uint512_compare(&square, &product));
+    }
+}
+
+CTEST(mont, full_width_roundtrip) {
+    /* 2^512 - 569, the largest 512-bit prime */
+    uint512_t m = UINT512_MAX;
+    m.words[0] -= 568;
+    uint512_mont_ctx_t ctx;
+    ASSERT_EQUAL(INT512_OK, uint512_mont_init(&ctx, &m));
+
+    /* A product below m comes back unchanged from the plain multiply */
+    uint512_t a = {{123456789, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t b = {{0, 0, 0, 0, 1ULL << 44, 0, 0, 0}};
+    uint512_t am, bm, product, expected;
+    ASSERT_EQUAL(INT512_OK, uint512_to_mont(&ctx, &a, &am));
+    ASSERT_EQUAL(INT512_OK, uint512_to_mont(&ctx, &b, &bm));
+    ASSERT_EQUAL(INT512_OK, uint512_mont_mul(&ctx, &am, &bm, &product));
+    ASSERT_EQUAL(INT512_OK, uint512_from_mont(&ctx, &product, &product));
+    ASSERT_EQUAL(INT512_OK, uint512_mul(&a, &b, &expected));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &product));
+
+    /* (m - 1)^2 = 1 mod m */
+    uint512_t minus_one = m;
+    minus_one.words[0] -= 1;
+    ASSERT_EQUAL(INT512_OK, uint512_to_mont(&ctx, &minus_one, &am));
+    ASSERT_EQUAL(INT512_OK, uint512_mont_sqr(&ctx, &am, &product));
+    ASSERT_EQUAL(INT512_OK, uint512_from_mont(&ctx, &product, &product));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &product));
+}
+
+CTEST(powmod, known_values) {
+    uint512_t base = {{7, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t exponent = {{123456789, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t modulus = {{1000000007, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_powmod(&base, &exponent, &modulus, &result));
+    ASSERT_EQUAL(467332791ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_powmod_ct(&base, &exponent, &modulus, &result));
+    ASSERT_EQUAL(467332791ULL, result.words[0]);
+
+    /* Even modulus 2^200 - 6, Barrett reduced */
+    uint512_t five = {{5, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t e = {{17, 0, 4, 0, 0, 0, 0, 0}};
+    uint512_t even = {{UINT64_MAX - 5, UINT64_MAX, UINT64_MAX, 0xff, 0, 0, 0, 0}};
+    uint512_t expected = {{0x0fb888ba7da6fd51ULL, 0x261592bcf5cfa382ULL, 0x89965f9cc551cc9bULL, 0xe2, 0, 0, 0, 0}};
+    ASSERT_EQUAL(INT512_OK, uint512_powmod(&five, &e, &even, &result));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, uint512_powmod_ct(&five, &e, &even, &result));
+}
+
+CTEST(powmod, fermat) {
+    /* a^(p-1) = 1 mod p for p = 2^512 - 569 */
+    uint512_t p = UINT512_MAX;
+    p.words[0] -= 568;
+    uint512_t e = p;
+    e.words[0] -= 1;
+    uint512_t a = {{0x0123456789abcdefULL, 42, 0, 0, 0, 0, 0, 0x7777777777777777ULL}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_powmod(&a, &e, &p, &result));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &result));
+    ASSERT_EQUAL(INT512_OK, uint512_powmod_ct(&a, &e, &p, &result));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &result));
+}
+
+CTEST(powmod, edge_cases) {
+    uint512_t base = {{3, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t modulus = {{97, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_powmod(&base, &UINT512_ZERO, &modulus, &result));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &result));
+    ASSERT_EQUAL(INT512_OK, uint512_powmod_ct(&base, &UINT512_ZERO, &modulus, &result));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &result));
+
+    ASSERT_EQUAL(INT512_OK, uint512_powmod(&base, &UINT512_MAX, &UINT512_ONE, &result));
+    ASSERT_TRUE(uint512_is_zero(&result));
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_powmod(&base, &base, &UINT512_ZERO, &result));
+
+    /* Base wider than the modulus */
+    ASSERT_EQUAL(INT512_OK, uint512_powmod(&UINT512_MAX, &base, &modulus, &result));
+    uint512_t expected, q;
+    uint512_div(&UINT512_MAX, &modulus, &q, &expected);
+    uint512_t cube = expected;
+    uint512_mul(&cube, &expected, &cube);
+    uint512_mul(&cube, &expected, &cube);
+    uint512_div(&cube, &modulus, &q, &expected);
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+}
+
+CTEST(barrett, matches_div) {
+    /* 10^38 (2 limbs), 2^320 (mu needs an extra limb) and 2^512 - 2 */
+    uint512_t moduli[] = {
+        {{0x098a224000000000ULL, 0x4b3b4ca85a86c47aULL, 0, 0, 0, 0, 0, 0}},
+        {{0, 0, 0, 0, 0, 1, 0, 0}},
+        {{UINT64_MAX - 1, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}},
+    };
+    uint512_t a = {{0x0123456789abcdefULL, 0xfedcba9876543210ULL, 3, 0, 0, 0, 0, 0}};
+    uint512_t b = {{UINT64_MAX, 0x8000000000000000ULL, 0, 0, 0, 0, 0, 0}};
+
+    for (size_t i = 0; i < sizeof(moduli) / sizeof(moduli[0]); i++) {
+        uint512_barrett_ctx_t ctx;
+        uint512_t r, expected, q, minus_one;
+
+        ASSERT_EQUAL(INT512_OK, uint512_barrett_init(&ctx, &moduli[i]));
+        ASSERT_EQUAL(INT512_OK, uint512_barrett_mod(&ctx, &UINT512_MAX, &r));
+        ASSERT_EQUAL(INT512_OK, uint512_div(&UINT512_MAX, &moduli[i], &q, &expected));
+        ASSERT_EQUAL(0, uint512_compare(&expected, &r));
+
+        /* a b < 2^512, so the plain product reduces to the same residue */
+        ASSERT_EQUAL(INT512_OK, uint512_barrett_mulmod(&ctx, &a, &b, &r));
+        ASSERT_EQUAL(INT512_OK, uint512_mul(&a, &b, &expected));
+        ASSERT_EQUAL(INT512_OK, uint512_div(&expected, &moduli[i], &q, &expected));
+        ASSERT_EQUAL(0, uint512_compare(&expected, &r));
+
+        /* (m - 1)^2 = 1 and (m - 1) + (m - 1) = m - 2 */
+        ASSERT_EQUAL(INT512_OK, uint512_sub(&moduli[i], &UINT512_ONE, &minus_one));
+        ASSERT_EQUAL(INT512_OK, uint512_barrett_mulmod(&ctx, &minus_one, &minus_one, &r));
+        ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &r));
+        ASSERT_EQUAL(INT512_OK, uint512_barrett_addmod(&ctx, &minus_one, &minus_one, &r));
+        ASSERT_EQUAL(INT512_OK, uint512_sub(&minus_one, &UINT512_ONE, &expected));
+        ASSERT_EQUAL(0, uint512_compare(&expected, &r));
+    }
+
+    uint512_barrett_ctx_t ctx;
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_barrett_init(&ctx, &UINT512_ZERO));
+}
+
+CTEST(barrett, signed_residue) {
+    uint512_t ten = {{10, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_barrett_ctx_t ctx;
+    ASSERT_EQUAL(INT512_OK, uint512_barrett_init(&ctx, &ten));
+
+    int512_t minus_seven = {{(uint64_t)-7, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX,
+                             UINT64_MAX, UINT64_MAX}};
+    int512_t minus_five = {{(uint64_t)-5, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX,
+                            UINT64_MAX, UINT64_MAX}};
+    int512_t four = {{4, 0, 0, 0, 0, 0, 0, 0}};
+    int512_t r;
+
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mod(&ctx, &minus_seven, &r));
+    ASSERT_EQUAL(3ULL, r.words[0]);
+    ASSERT_FALSE(int512_is_negative(&r));
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mulmod(&ctx, &minus_seven, &four, &r));
+    ASSERT_EQUAL(2ULL, r.words[0]);
+    ASSERT_EQUAL(INT512_OK, int512_barrett_addmod(&ctx, &minus_seven, &minus_five, &r));
+    ASSERT_EQUAL(8ULL, r.words[0]);
+
+    /* -2^511 = -(2^511 mod 10) = -8 = 2 mod 10 */
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mod(&ctx, &INT512_MIN, &r));
+    ASSERT_EQUAL(2ULL, r.words[0]);
+    ASSERT_EQUAL(0ULL, r.words[7]);
+
+    /* m = 2^511 is the largest modulus whose residues all fit in an
+       int512_t: -7 = m - 7, -7 * -5 = 35, -7 + -5 = m - 12 */
+    ASSERT_EQUAL(INT512_OK, uint512_barrett_init(&ctx, (const uint512_t *)&INT512_MIN));
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mod(&ctx, &minus_seven, &r));
+    ASSERT_FALSE(int512_is_negative(&r));
+    ASSERT_EQUAL(UINT64_MAX - 6, r.words[0]);
+    ASSERT_EQUAL((uint64_t)INT64_MAX, r.words[7]);
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mulmod(&ctx, &minus_seven, &minus_five, &r));
+    ASSERT_EQUAL(35ULL, r.words[0]);
+    ASSERT_EQUAL(0ULL, r.words[7]);
+    ASSERT_EQUAL(INT512_OK, int512_barrett_addmod(&ctx, &minus_seven, &minus_five, &r));
+    ASSERT_FALSE(int512_is_negative(&r));
+    ASSERT_EQUAL(UINT64_MAX - 11, r.words[0]);
+    ASSERT_EQUAL((uint64_t)INT64_MAX, r.words[7]);
+    /* -2^511 = 0 and INT512_MAX is its own residue */
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mod(&ctx, &INT512_MIN, &r));
+    ASSERT_TRUE(int512_is_zero(&r));
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mod(&ctx, &INT512_MAX, &r));
+    ASSERT_EQUAL(0, int512_compare(&INT512_MAX, &r));
+
+    /* m = 2^511 - 1: -2^511 = -1 = m - 1 */
+    ASSERT_EQUAL(INT512_OK, uint512_barrett_init(&ctx, (const uint512_t *)&INT512_MAX));
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mod(&ctx, &INT512_MIN, &r));
+    ASSERT_EQUAL(UINT64_MAX - 1, r.words[0]);
+    ASSERT_EQUAL((uint64_t)INT64_MAX, r.words[7]);
+    ASSERT_EQUAL(INT512_OK, int512_barrett_mod(&ctx, &minus_seven, &r));
+    ASSERT_EQUAL(UINT64_MAX - 7, r.words[0]);
+
+    /* Above 2^511 a residue may not fit; m = 2^512 - 2^64 and m = 2^511 + 1 */
+    uint512_t big = UINT512_MAX;
+    big.words[0] = 0;
+    ASSERT_EQUAL(INT512_OK, uint512_barrett_init(&ctx, &big));
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, int512_barrett_mod(&ctx, &minus_seven, &r));
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, int512_barrett_mulmod(&ctx, &minus_seven, &four, &r));
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, int512_barrett_addmod(&ctx, &minus_seven, &minus_five, &r));
+    uint512_t above = *(const uint512_t *)&INT512_MIN;
+    above.words[0] = 1;
+    ASSERT_EQUAL(INT512_OK, uint512_barrett_init(&ctx, &above));
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, int512_barrett_mod(&ctx, &minus_seven, &r));
+    /* The unsigned calls still take such moduli */
+    ASSERT_EQUAL(INT512_OK, uint512_barrett_mod(&ctx, &UINT512_MAX, &big));
+}
+
+/* ============================================================================
+ * GCD and Modular Inverse Tests
+ * ============================================================================ */
+
+CTEST(gcd, known_values) {
+    uint512_t a = {{48, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t b = {{180, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_gcd(&a, &b, &result));
+    ASSERT_EQUAL(12ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_gcd(&UINT512_ZERO, &b, &result));
+    ASSERT_EQUAL(180ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_gcd(&UINT512_ZERO, &UINT512_ZERO, &result));
+    ASSERT_TRUE(uint512_is_zero(&result));
+
+    /* gcd(2^512 - 1, 2^384 - 1) = 2^128 - 1 */
+    uint512_t c = {{UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX, 0, 0}};
+    uint512_t expected = {{UINT64_MAX, UINT64_MAX, 0, 0, 0, 0, 0, 0}};
+    ASSERT_EQUAL(INT512_OK, uint512_gcd(&UINT512_MAX, &c, &result));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+
+    /* 3 * 2^64 and 5 * 2^64 */
+    uint512_t d = {{0, 3, 0, 0, 0, 0, 0, 0}};
+    uint512_t e = {{0, 5, 0, 0, 0, 0, 0, 0}};
+    ASSERT_EQUAL(INT512_OK, uint512_gcd(&d, &e, &result));
+    ASSERT_EQUAL(0ULL, result.words[0]);
+    ASSERT_EQUAL(1ULL, result.words[1]);
+}
+
+CTEST(gcd, xgcd_fibonacci) {
+    /* Consecutive Fibonacci numbers take the most Euclid steps:
+       F(739) x + F(738) y = 1 with x = -F(736) and y = F(737) */
+    uint512_t fib[740];
+    fib[0] = UINT512_ZERO;
+    fib[1] = UINT512_ONE;
+    for (int i = 2; i < 740; i++) {
+        ASSERT_EQUAL(INT512_OK, uint512_add(&fib[i - 1], &fib[i - 2], &fib[i]));
+    }
+
+    uint512_t g;
+    int512_t x, y;
+    ASSERT_EQUAL(INT512_OK, uint512_xgcd(&fib[739], &fib[738], &g, &x, &y));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_ONE, &g));
+    ASSERT_TRUE(int512_is_negative(&x));
+    ASSERT_EQUAL(INT512_OK, int512_sub(&INT512_ZERO, &x, &x));
+    ASSERT_EQUAL(0, memcmp(fib[736].words, x.words, sizeof(x.words)));
+    ASSERT_EQUAL(0, memcmp(fib[737].words, y.words, sizeof(y.words)));
+
+    /* b = 0 gives (a, 1, 0) */
+    ASSERT_EQUAL(INT512_OK, uint512_xgcd(&fib[20], &UINT512_ZERO, &g, &x, &y));
+    ASSERT_EQUAL(0, uint512_compare(&fib[20], &g));
+    ASSERT_EQUAL(1ULL, x.words[0]);
+    ASSERT_TRUE(int512_is_zero(&y));
+}
+
+CTEST(gcd, modinv) {
+    /* 2^-1 mod 2^255 - 19 is (m + 1) / 2 */
+    uint512_t m = {{UINT64_MAX - 18, UINT64_MAX, UINT64_MAX, UINT64_MAX >> 1, 0, 0, 0, 0}};
+    uint512_t two = {{2, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t expected = {{UINT64_MAX - 8, UINT64_MAX, UINT64_MAX, UINT64_MAX >> 2, 0, 0, 0, 0}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_modinv(&two, &m, &result));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+    ASSERT_EQUAL(INT512_OK, uint512_modinv_ct(&two, &m, &result));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+
+    /* An unreduced operand has the same inverse */
+    uint512_t wide;
+    ASSERT_EQUAL(INT512_OK, uint512_add(&m, &two, &wide));
+    ASSERT_EQUAL(INT512_OK, uint512_modinv(&wide, &m, &result));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+    ASSERT_EQUAL(INT512_OK, uint512_modinv_ct(&wide, &m, &result));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+
+    uint512_t six = {{6, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t nine = {{9, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t ten = {{10, 0, 0, 0, 0, 0, 0, 0}};
+    ASSERT_EQUAL(INT512_ERR_NOT_INVERTIBLE, uint512_modinv(&six, &ten, &result));
+    ASSERT_EQUAL(INT512_ERR_NOT_INVERTIBLE, uint512_modinv_ct(&six, &nine, &result));
+    ASSERT_EQUAL(INT512_ERR_INVALID_MODULUS, uint512_modinv_ct(&nine, &ten, &result));
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_modinv(&six, &UINT512_ZERO, &result));
+
+    ASSERT_EQUAL(INT512_OK, uint512_modinv(&nine, &ten, &result));
+    ASSERT_EQUAL(9ULL, result.words[0]);
+}
+
+/* ============================================================================
+ * Integer Root Tests
+ * ============================================================================ */
+
+CTEST(roots, isqrt) {
+    uint512_t a = {{99, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t root, rem;
+
+    ASSERT_EQUAL(INT512_OK, uint512_isqrt(&a, &root, &rem));
+    ASSERT_EQUAL(9ULL, root.words[0]);
+    ASSERT_EQUAL(18ULL, rem.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_isqrt(&UINT512_ZERO, &root, NULL));
+    ASSERT_TRUE(uint512_is_zero(&root));
+
+    /* isqrt(2^512 - 1) = 2^256 - 1 with remainder 2^257 - 2 */
+    ASSERT_EQUAL(INT512_OK, uint512_isqrt(&UINT512_MAX, &root, &rem));
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQUAL(i < 4 ? UINT64_MAX : 0ULL, root.words[i]);
+        ASSERT_EQUAL(i == 0 ? UINT64_MAX - 1 : i < 4 ? UINT64_MAX : i == 4 ? 1ULL : 0ULL, rem.words[i]);
+    }
+
+    /* (2^200 + 3)^2 and one less */
+    uint512_t x = {{3, 0, 0, 1ULL << 8, 0, 0, 0, 0}};
+    uint512_t square;
+    ASSERT_EQUAL(INT512_OK, uint512_mul(&x, &x, &square));
+    ASSERT_EQUAL(INT512_OK, uint512_isqrt(&square, &root, &rem));
+    ASSERT_EQUAL(0, uint512_compare(&x, &root));
+    ASSERT_TRUE(uint512_is_zero(&rem));
+    ASSERT_EQUAL(INT512_OK, uint512_sub(&square, &UINT512_ONE, &square));
+    ASSERT_EQUAL(INT512_OK, uint512_isqrt(&square, &root, &rem));
+    ASSERT_EQUAL(2ULL, root.words[0]);
+    ASSERT_EQUAL(1ULL << 8, root.words[3]);
+}
+
+CTEST(roots, iroot) {
+    uint512_t a = {{1000, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&a, 3, &result));
+    ASSERT_EQUAL(10ULL, result.words[0]);
+    a.words[0] = 999;
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&a, 3, &result));
+    ASSERT_EQUAL(9ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&a, 1, &result));
+    ASSERT_EQUAL(999ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_iroot(&a, 0, &result));
+
+    /* (2^512 - 1)^(1/k) for k = 7, 64, 511 and 512 */
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&UINT512_MAX, 7, &result));
+    ASSERT_EQUAL(0x4b38822bcfac8af8ULL, result.words[0]);
+    ASSERT_EQUAL(0x235ULL, result.words[1]);
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&UINT512_MAX, 64, &result));
+    ASSERT_EQUAL(255ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&UINT512_MAX, 511, &result));
+    ASSERT_EQUAL(2ULL, result.words[0]);
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&UINT512_MAX, 512, &result));
+    ASSERT_EQUAL(1ULL, result.words[0]);
+
+    /* 3^300 is a perfect cube, square and fifth power */
+    uint512_t three = {{3, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t p = UINT512_ONE;
+    for (int i = 0; i < 300; i++) {
+        ASSERT_EQUAL(INT512_OK, uint512_mul(&p, &three, &p));
+    }
+    uint512_t expected = UINT512_ONE;
+    for (int i = 0; i < 60; i++) {
+        ASSERT_EQUAL(INT512_OK, uint512_mul(&expected, &three, &expected));
+    }
+    ASSERT_EQUAL(INT512_OK, uint512_iroot(&p, 5, &result));
+    ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+    ASSERT_TRUE(uint512_is_perfect_square(&p));
+}
+
+CTEST(roots, is_perfect_square) {
+    uint512_t a = UINT512_ZERO;
+    ASSERT_TRUE(uint512_is_perfect_square(&a));
+
+    /* Squares and their neighbours below 2^20 */
+    int squares = 0;
+    for (uint64_t v = 1; v < (1 << 20); v++) {
+        a.words[0] = v;
+        if (uint512_is_perfect_square(&a)) squares++;
+    }
+    ASSERT_EQUAL(1023, squares);
+
+    /* 2^511 is not a square, 2^510 is */
+    uint512_t b = {{0, 0, 0, 0, 0, 0, 0, 1ULL << 63}};
+    ASSERT_FALSE(uint512_is_perfect_square(&b));
+    b.words[7] = 1ULL << 62;
+    ASSERT_TRUE(uint512_is_perfect_square(&b));
+    ASSERT_FALSE(uint512_is_perfect_square(&UINT512_MAX));
+}
+
+/* ============================================================================
+ * Primality Tests
+ * ============================================================================ */
+
+CTEST(prime, small_values) {
+    uint512_t a = UINT512_ZERO;
+    int primes = 0;
+    for (uint64_t v = 0; v < 10000; v++) {
+        a.words[0] = v;
+        if (uint512_is_probable_prime(&a)) primes++;
+    }
+    ASSERT_EQUAL(1229, primes);
+
+    /* Around the end of trial division: 2^20 - 3 is prime, 1031^2 is not */
+    a.words[0] = (1 << 20) - 3;
+    ASSERT_TRUE(uint512_is_probable_prime(&a));
+    a.words[0] = 1031 * 1031;
+    ASSERT_FALSE(uint512_is_probable_prime(&a));
+}
+
+CTEST(prime, large_values) {
+    /* 2^127 - 1, 2^256 - 189 and 2^512 - 569 are prime */
+    uint512_t m127 = {{UINT64_MAX, UINT64_MAX >> 1, 0, 0, 0, 0, 0, 0}};
+    uint512_t p256 = {{UINT64_MAX - 188, UINT64_MAX, UINT64_MAX, UINT64_MAX, 0, 0, 0, 0}};
+    uint512_t p512 = UINT512_MAX;
+    p512.words[0] -= 568;
+    ASSERT_TRUE(uint512_is_probable_prime(&m127));
+    ASSERT_TRUE(uint512_is_probable_prime(&p256));
+    ASSERT_TRUE(uint512_is_probable_prime(&p512));
+
+    uint512_t two = {{2, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t c;
+    ASSERT_EQUAL(INT512_OK, uint512_sub(&p512, &two, &c));
+    ASSERT_FALSE(uint512_is_probable_prime(&c));
+    ASSERT_EQUAL(INT512_OK, uint512_mul(&m127, &p256, &c));
+    ASSERT_FALSE(uint512_is_probable_prime(&c));
+
+    /* Strong pseudoprimes to base 2 with no factor below 1024, which only
+       the Lucas test rejects */
+    uint512_t spsp1 = {{3825123056546413051ULL, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t spsp2 = {{0xe92817f9fc85b7e5ULL, 0x437a, 0, 0, 0, 0, 0, 0}};
+    ASSERT_FALSE(uint512_is_probable_prime(&spsp1));
+    ASSERT_FALSE(uint512_is_probable_prime(&spsp2));
+}
+
+/* ============================================================================
+ * Batch Arithmetic Tests
+ * ============================================================================ */
+
+CTEST(batch, arrays) {
+    /* 70 elements so the status bitmap spans two words */
+    enum { N = 70 };
+    uint512_t a[N], b[N], r[N];
+    uint64_t status[2];
+    int8_t cmp[N];
+
+    for (int i = 0; i < N; i++) {
+        a[i] = UINT512_MAX;
+        a[i].words[0] = UINT64_MAX - (uint64_t)i;
+        b[i] = UINT512_ZERO;
+        b[i].words[0] = i == 3 || i == 66 ? 100 : 1;
+    }
+
+    /* a + 1 only carries out of element 0; a + 100 carries out of 3 and 66 */
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_add_n(a, b, r, N, status));
+    ASSERT_EQUAL(0x9ULL, status[0]);
+    ASSERT_EQUAL(0x4ULL, status[1]);
+    ASSERT_EQUAL(UINT64_MAX, r[1].words[0]);
+    ASSERT_EQUAL(UINT64_MAX, r[1].words[7]);
+
+    ASSERT_EQUAL(INT512_OK, uint512_sub_n(a, b, r, N, status));
+    ASSERT_EQUAL(0ULL, status[0]);
+    ASSERT_EQUAL(0ULL, status[1]);
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, uint512_sub_n(b, a, r, N, NULL));
+
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul_n(a, b, r, N, status));
+    ASSERT_EQUAL(0x8ULL, status[0]);
+    ASSERT_EQUAL(0x4ULL, status[1]);
+    ASSERT_EQUAL(0, uint512_compare(&a[5], &r[5]));
+
+    ASSERT_EQUAL(INT512_OK, uint512_cmp_n(a, a, cmp, N));
+    ASSERT_EQUAL(0, cmp[69]);
+    ASSERT_EQUAL(INT512_OK, uint512_cmp_n(b, a, cmp, N));
+    ASSERT_EQUAL(-1, cmp[0]);
+    ASSERT_EQUAL(-1, cmp[69]);
+    ASSERT_EQUAL(INT512_ERR_NULL_POINTER, uint512_add_n(a, NULL, r, N, status));
+}
+
+CTEST(batch, soa_matches_arrays) {
+    /* 13 elements: a full AVX-512 group, a full AVX2 group and a scalar tail */
+    enum { N = 13 };
+    uint64_t pa[8][N], pb[8][N], pr[8][N];
+    uint512_t a[N], b[N], r[N];
+    uint64_t status_aos, status_soa;
+    int8_t cmp_aos[N], cmp_soa[N];
+    uint512_soa_t sa, sb, sr;
+
+    for (int k = 0; k < 8; k++) {
+        sa.limbs[k] = pa[k];
+        sb.limbs[k] = pb[k];
+        sr.limbs[k] = pr[k];
+    }
+    rng_seed(0x9e3779b97f4a7c15ULL);
+    for (int i = 0; i < N; i++) {
+        for (int k = 0; k < 8; k++) {
+            uint64_t x = rng_next();
+            /* Runs of all-ones and zero limbs exercise carry propagation */
+            a[i].words[k] = i % 3 == 0 ? UINT64_MAX : x;
+            b[i].words[k] = i % 3 == 1 ? 0 : k < 2 ? x >> (i % 64) : (i % 2 ? 0 : x);
+            pa[k][i] = a[i].words[k];
+            pb[k][i] = b[i].words[k];
+        }
+    }
+    b[12] = a[12];
+    for (int k = 0; k < 8; k++) pb[k][12] = pa[k][12];
+
+    for (int op = 0; op < 3; op++) {
+        int512_error_t e_aos, e_soa;
+        if (op == 0) {
+            e_aos = uint512_add_n(a, b, r, N, &status_aos);
+            e_soa = uint512_add_n_soa(&sa, &sb, &sr, N, &status_soa);
+        } else if (op == 1) {
+            e_aos = uint512_sub_n(a, b, r, N, &status_aos);
+            e_soa = uint512_sub_n_soa(&sa, &sb, &sr, N, &status_soa);
+        } else {
+            e_aos = uint512_mul_n(a, b, r, N, &status_aos);
+            e_soa = uint512_mul_n_soa(&sa, &sb, &sr, N, &status_soa);
+        }
+        ASSERT_EQUAL(e_aos, e_soa);
+        ASSERT_EQUAL(status_aos, status_soa);
+        for (int i = 0; i < N; i++) {
+            for (int k = 0; k < 8; k++) {
+                ASSERT_EQUAL(r[i].words[k], pr[k][i]);
+            }
+        }
+    }
+
+    ASSERT_EQUAL(INT512_OK, uint512_cmp_n(a, b, cmp_aos, N));
+    ASSERT_EQUAL(INT512_OK, uint512_cmp_n_soa(&sa, &sb, cmp_soa, N));
+    ASSERT_EQUAL(0, memcmp(cmp_aos, cmp_soa, N));
+    ASSERT_EQUAL(0, cmp_soa[12]);
+}
+
+CTEST(batch, mul_n_overflow_edge) {
+    /* Products of powers of two landing on either side of 2^512, with the
+       exponents split across the 52-bit limbs used by the IFMA engine;
+       odd elements subtract one from a to spread the bits */
+    static const int exps[][2] = {
+        {256, 255}, {256, 256}, {468, 43}, {468, 44}, {51, 461}, {51, 460},
+        {0, 511}, {1, 511}, {259, 252}, {260, 252}, {312, 200}, {104, 408},
+        {511, 0}, {300, 212}, {511, 1}, {415, 96},
+    };
+    enum { N = sizeof(exps) / sizeof(exps[0]) };
+    uint512_t a[N], b[N], r[N];
+    uint64_t status;
+
+    for (int i = 0; i < N; i++) {
+        a[i] = UINT512_ZERO;
+        b[i] = UINT512_ZERO;
+        a[i].words[exps[i][0] / 64] = 1ULL << (exps[i][0] % 64);
+        b[i].words[exps[i][1] / 64] = 1ULL << (exps[i][1] % 64);
+        if (i % 2) uint512_sub(&a[i], &UINT512_ONE, &a[i]);
+    }
+
+    /* Only the even elements 4, 10 and 14 reach 2^512 */
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul_n(a, b, r, N, &status));
+    ASSERT_EQUAL(0x4410ULL, status);
+    for (int i = 0; i < N; i++) {
+        uint512_t expected;
+        int512_error_t e = uint512_mul(&a[i], &b[i], &expected);
+        ASSERT_EQUAL(0, uint512_compare(&expected, &r[i]));
+        ASSERT_EQUAL(e != INT512_OK, (int)((status >> i) & 1));
+    }
+}
+
+/* ============================================================================
+ * Parallel Reduction Tests
+ * ============================================================================ */
+
+/* Large enough for several threads of REDUCE_MIN_CHUNK elements */
+enum { REDUCE_N = 70001 };
+
+CTEST(reduce, uint512_sum_array) {
+    static uint512_t a[REDUCE_N];
+    uint512_t r1, r4;
+
+    for (int i = 0; i < REDUCE_N; i++) {
+        a[i] = UINT512_ZERO;
+        a[i].words[0] = (uint64_t)i;
+        a[i].words[7] = (uint64_t)i << 30;
+    }
+    ASSERT_EQUAL(INT512_OK, uint512_sum_array(a, REDUCE_N, &r1, 1));
+    ASSERT_EQUAL(INT512_OK, uint512_sum_array(a, REDUCE_N, &r4, 4));
+    ASSERT_EQUAL(0, uint512_compare(&r1, &r4));
+    ASSERT_EQUAL((uint64_t)REDUCE_N * (REDUCE_N - 1) / 2, r1.words[0]);
+
+    /* Wraps to the same value as a sequential loop of uint512_add */
+    a[0] = UINT512_MAX;
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_sum_array(a, REDUCE_N, &r4, 4));
+    ASSERT_EQUAL((uint64_t)REDUCE_N * (REDUCE_N - 1) / 2 - 1, r4.words[0]);
+    ASSERT_EQUAL(r1.words[7], r4.words[7]);
+
+    ASSERT_EQUAL(INT512_OK, uint512_sum_array(a, 0, &r1, 0));
+    ASSERT_TRUE(uint512_is_zero(&r1));
+    ASSERT_EQUAL(INT512_ERR_NULL_POINTER, uint512_sum_array(NULL, 1, &r1, 0));
+}
+
+/* The loops the reductions must agree with: the first error and the
+   wrapped total */
+static int512_error_t sequential_sum(const int512_t *a, size_t count, int512_t *result) {
+    int512_error_t first = INT512_OK;
+    *result = INT512_ZERO;
+    for (size_t i = 0; i < count; i++) {
+        int512_error_t e = int512_add(result, &a[i], result);
+        if (first == INT512_OK) first = e;
+    }
+    return first;
+}
+
+static int512_error_t sequential_dot(const int512_t *a, const int512_t *b, size_t count, int512_t *result) {
+    int512_error_t first = INT512_OK;
+    *result = INT512_ZERO;
+    for (size_t i = 0; i < count; i++) {
+        int512_t p;
+        int512_error_t e = int512_mul(&a[i], &b[i], &p);
+        if (first == INT512_OK) first = e;
+        e = int512_add(result, &p, result);
+        if (first == INT512_OK) first = e;
+    }
+    return first;
+}
+
+/* Both thread counts against the sequential loop; returns its error */
+static int512_error_t check_sum_array(const int512_t *a, size_t count) {
+    int512_t expected, r1, r4;
+    int512_error_t e = sequential_sum(a, count, &expected);
+    ASSERT_EQUAL(e, int512_sum_array(a, count, &r1, 1));
+    ASSERT_EQUAL(e, int512_sum_array(a, count, &r4, 4));
+    ASSERT_EQUAL(0, int512_compare(&expected, &r1));
+    ASSERT_EQUAL(0, int512_compare(&expected, &r4));
+    return e;
+}
+
+static int512_error_t check_dot_array(const int512_t *a, const int512_t *b, size_t count) {
+    int512_t expected, r1, r4;
+    int512_error_t e = sequential_dot(a, b, count, &expected);
+    ASSERT_EQUAL(e, int512_dot_array(a, b, count, &r1, 1));
+    ASSERT_EQUAL(e, int512_dot_array(a, b, count, &r4, 4));
+    ASSERT_EQUAL(0, int512_compare(&expected, &r1));
+    ASSERT_EQUAL(0, int512_compare(&expected, &r4));
+    return e;
+}
+
+CTEST(reduce, int512_sum_array) {
+    static int512_t a[REDUCE_N];
+    int512_t minus_one, r;
+    int512_sub(&INT512_ZERO, &INT512_ONE, &minus_one);
+
+    /* Pairs +i, -i that cancel */
+    for (int i = 0; i + 1 < REDUCE_N; i += 2) {
+        int512_add_i64(&INT512_ZERO, i, &a[i]);
+        int512_add_i64(&INT512_ZERO, -i, &a[i + 1]);
+    }
+    a[REDUCE_N - 1] = INT512_ZERO;
+    ASSERT_EQUAL(INT512_OK, check_sum_array(a, REDUCE_N));
+
+    /* MAX, 1, -1: the running sum leaves the range at the 1 and comes back,
+       which the loop still reports */
+    a[0] = INT512_MAX;
+    a[1] = INT512_ONE;
+    a[2] = minus_one;
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, check_sum_array(a, REDUCE_N));
+    ASSERT_EQUAL(INT512_OK, int512_sum_array(a, 1, &r, 4));
+
+    /* The same in the third of four ranges */
+    a[0] = INT512_ZERO;
+    a[1] = INT512_ZERO;
+    a[2] = INT512_ZERO;
+    a[3] = INT512_ZERO;
+    a[50000] = INT512_MAX;
+    a[50001] = INT512_ONE;
+    a[50002] = minus_one;
+    a[50003] = INT512_ZERO;
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, check_sum_array(a, REDUCE_N));
+
+    /* An earlier underflow wins over that overflow, though the total of
+       MIN and MAX is -1 */
+    a[10] = INT512_MIN;
+    a[11] = minus_one;
+    a[12] = INT512_ONE;
+    a[13] = INT512_ZERO;
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, check_sum_array(a, REDUCE_N));
+    int512_sum_array(a, REDUCE_N, &r, 4);
+    ASSERT_EQUAL(0, int512_compare(&minus_one, &r));
+}
+
+CTEST(reduce, int512_dot_array) {
+    static int512_t a[REDUCE_N], b[REDUCE_N];
+
+    for (int i = 0; i < REDUCE_N; i++) {
+        int512_add_i64(&INT512_ZERO, (int64_t)i - REDUCE_N / 2, &a[i]);
+        int512_add_i64(&INT512_ZERO, i % 3 ? 0x123456789LL : -0x987654321LL, &b[i]);
+    }
+    ASSERT_EQUAL(INT512_OK, check_dot_array(a, b, REDUCE_N));
+
+    /* 2^256 * 2^256 fails in int512_mul even though 2^256 * -2^256 then
+       cancels it */
+    a[0] = INT512_ZERO;
+    a[0].words[4] = 1;
+    b[0] = a[0];
+    a[1] = a[0];
+    int512_sub(&INT512_ZERO, &a[0], &b[1]);
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, check_dot_array(a, b, 2));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, check_dot_array(a, b, REDUCE_N));
+
+    /* Products in range whose running sum leaves it, with every other
+       product zero: -2^510 twice reaches INT512_MIN and a further -1
+       underflows */
+    int512_t half_min = INT512_ZERO, minus_one;
+    half_min.words[7] = 0xc000000000000000ULL;
+    int512_sub(&INT512_ZERO, &INT512_ONE, &minus_one);
+    for (int i = 0; i < REDUCE_N; i++) b[i] = INT512_ZERO;
+    a[60000] = half_min;
+    a[60001] = half_min;
+    a[60002] = minus_one;
+    b[60000] = b[60001] = b[60002] = INT512_ONE;
+    ASSERT_EQUAL(INT512_OK, check_dot_array(a, b, 60002));
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, check_dot_array(a, b, REDUCE_N));
+    /* Negated, +2^510 twice already overflows */
+    b[60000] = b[60001] = b[60002] = minus_one;
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, check_dot_array(a, b, 60002));
+    ASSERT_EQUAL(INT512_OK, check_dot_array(a, b, 60001));
+}
+
 /* ============================================================================
  * Mixed-size Operations Tests
  * ============================================================================ */
@@ -217,6 +1443,41 @@ CTEST(uint512, mul_u32) {
     ASSERT_EQUAL(1000000ULL, result.words[0]);
 }
 
+CTEST(uint512, add_sub_u8_carry_chain) {
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_add_u8(&UINT512_MAX, 1, &result));
+    ASSERT_TRUE(uint512_is_zero(&result));
+
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, uint512_sub_u8(&UINT512_ZERO, 1, &result));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_MAX, &result));
+
+    /* Carry stops in limb 1; the upper limbs are copied through */
+    uint512_t a = {{UINT64_MAX, 5, 0, 0, 0, 0, 0, 7}};
+    ASSERT_EQUAL(INT512_OK, uint512_add_u8(&a, 1, &a));
+    ASSERT_EQUAL(0ULL, a.words[0]);
+    ASSERT_EQUAL(6ULL, a.words[1]);
+    ASSERT_EQUAL(7ULL, a.words[7]);
+}
+
+CTEST(uint512, mul_u128_matches_mul) {
+    uint64_t values[][2] = {{0, 0}, {1, 0}, {UINT64_MAX, 0}, {0, 1}, {UINT64_MAX, UINT64_MAX}, {12345, 1ULL << 63}};
+    uint512_t a = {{UINT64_MAX, 3, 0, 0x0123456789abcdefULL, 0, 0, 0, 0}};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        uint512_t b = {{values[i][0], values[i][1], 0, 0, 0, 0, 0, 0}};
+        uint512_t expected, result;
+
+        ASSERT_EQUAL(uint512_mul(&a, &b, &expected), uint512_mul_u128(&a, values[i], &result));
+        ASSERT_EQUAL(0, uint512_compare(&expected, &result));
+    }
+
+    uint64_t two_64[2] = {0, 1};
+    uint512_t top = {{0, 0, 0, 0, 0, 0, 0, 1ULL << 63}};
+    uint512_t result;
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul_u128(&top, two_64, &result));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_mul_u64(&top, 2, &result));
+}
+
 CTEST(uint512, div_u16) {
     uint512_t a = {{1000, 0, 0, 0, 0, 0, 0, 0}};
     uint512_t quotient;
@@ -227,6 +1488,44 @@ CTEST(uint512, div_u16) {
     ASSERT_EQUAL(10, remainder);
 }
 
+CTEST(uint512, div_u64_multi_limb) {
+    /* (2^192 + 3) * 1000003 + 17 */
+    uint512_t a = {{3ULL * 1000003 + 17, 0, 0, 1000003, 0, 0, 0, 0}};
+    uint512_t quotient;
+    uint64_t remainder;
+
+    ASSERT_EQUAL(INT512_OK, uint512_div_u64(&a, 1000003, &quotient, &remainder));
+    ASSERT_EQUAL(3ULL, quotient.words[0]);
+    ASSERT_EQUAL(1ULL, quotient.words[3]);
+    ASSERT_EQUAL(17ULL, remainder);
+}
+
+CTEST(uint512, div_u64_by_zero) {
+    uint512_t quotient;
+    uint64_t remainder;
+    uint512_divisor_u64_t divisor;
+
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_div_u64(&UINT512_ONE, 0, &quotient, &remainder));
+    ASSERT_EQUAL(INT512_ERR_DIVIDE_BY_ZERO, uint512_divisor_u64_init(&divisor, 0));
+}
+
+CTEST(uint512, div_u64_by_matches_div) {
+    uint64_t divisors[] = {1, 3, 10, 10000000000000000000ULL, (uint64_t)1 << 63, UINT64_MAX};
+    for (size_t d = 0; d < sizeof(divisors) / sizeof(divisors[0]); d++) {
+        uint512_divisor_u64_t divisor;
+        ASSERT_EQUAL(INT512_OK, uint512_divisor_u64_init(&divisor, divisors[d]));
+
+        uint512_t b = {{divisors[d], 0, 0, 0, 0, 0, 0, 0}};
+        uint512_t expected_q, expected_r, quotient;
+        uint64_t remainder;
+
+        ASSERT_EQUAL(INT512_OK, uint512_div(&UINT512_MAX, &b, &expected_q, &expected_r));
+        ASSERT_EQUAL(INT512_OK, uint512_div_u64_by(&UINT512_MAX, &divisor, &quotient, &remainder));
+        ASSERT_EQUAL(0, uint512_compare(&expected_q, &quotient));
+        ASSERT_EQUAL(expected_r.words[0], remainder);
+    }
+}
+
 CTEST(int512, add_i32) {
     int512_t a = {{100, 0, 0, 0, 0, 0, 0, 0}};
     int512_t result;
@@ -243,6 +1542,59 @@ CTEST(int512, mul_i64) {
     ASSERT_TRUE(int512_is_negative(&result));
 }
 
+CTEST(int512, add_sub_small_sign_extend) {
+    int512_t result;
+
+    ASSERT_EQUAL(INT512_OK, int512_add_i8(&INT512_ZERO, -1, &result));
+    for (int i = 0; i < 8; i++) ASSERT_EQUAL(UINT64_MAX, result.words[i]);
+
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_add_i16(&INT512_MAX, 1, &result));
+    ASSERT_EQUAL(INT512_ERR_UNDERFLOW, int512_add_i64(&INT512_MIN, -1, &result));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_sub_i32(&INT512_MAX, -1, &result));
+
+    int64_t minus_two_64[2] = {0, -1};
+    ASSERT_EQUAL(INT512_OK, int512_sub_i128(&INT512_ZERO, minus_two_64, &result));
+    ASSERT_EQUAL(0ULL, result.words[0]);
+    ASSERT_EQUAL(1ULL, result.words[1]);
+    ASSERT_EQUAL(0ULL, result.words[7]);
+}
+
+CTEST(int512, mul_small_min) {
+    int512_t result;
+
+    ASSERT_EQUAL(INT512_OK, int512_mul_i8(&INT512_MIN, 1, &result));
+    ASSERT_EQUAL(0, int512_compare(&INT512_MIN, &result));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, int512_mul_i8(&INT512_MIN, -1, &result));
+
+    int64_t minus_one[2] = {-1, -1};
+    ASSERT_EQUAL(INT512_OK, int512_mul_i128(&INT512_MAX, minus_one, &result));
+    ASSERT_EQUAL(INT512_OK, int512_add_i8(&result, -1, &result));
+    ASSERT_EQUAL(0, int512_compare(&INT512_MIN, &result));
+}
+
+CTEST(int512, div_i64_negative) {
+    int512_t a;
+    a.words[0] = (uint64_t)-100;
+    for (int i = 1; i < 8; i++) a.words[i] = UINT64_MAX;
+    int512_t quotient;
+    int64_t remainder;
+
+    ASSERT_EQUAL(INT512_OK, int512_div_i64(&a, 7, &quotient, &remainder));
+    ASSERT_TRUE(int512_is_negative(&quotient));
+    ASSERT_EQUAL((uint64_t)-14, quotient.words[0]);
+    ASSERT_EQUAL(-2, remainder);
+}
+
+CTEST(int512, div_i8_min) {
+    int512_t a = {{1000, 0, 0, 0, 0, 0, 0, 0}};
+    int512_t quotient;
+    int8_t remainder;
+
+    ASSERT_EQUAL(INT512_OK, int512_div_i8(&a, INT8_MIN, &quotient, &remainder));
+    ASSERT_EQUAL((uint64_t)-7, quotient.words[0]);
+    ASSERT_EQUAL(104, remainder);
+}
+
 /* ============================================================================
  * String Conversion Tests
  * ============================================================================ */
@@ -271,6 +1623,88 @@ CTEST(uint512, to_string_binary) {
     ASSERT_STR("101", buffer);
 }
 
+CTEST(uint512, to_string_max_decimal) {
+    char buffer[200];
+
+    ASSERT_EQUAL(INT512_OK, uint512_to_string(&UINT512_MAX, buffer, sizeof(buffer), 10));
+    ASSERT_STR("13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084095", buffer);
+}
+
+CTEST(uint512, to_string_chunk_zero_padding) {
+    /* 10^19 * 10^19 = 10^38 exercises an all-zero middle chunk */
+    uint512_t value = {{10000000000000000000ULL, 0, 0, 0, 0, 0, 0, 0}};
+    char buffer[200];
+
+    ASSERT_EQUAL(INT512_OK, uint512_mul_u64(&value, 10000000000000000000ULL, &value));
+    ASSERT_EQUAL(INT512_OK, uint512_to_string(&value, buffer, sizeof(buffer), 10));
+    ASSERT_STR("100000000000000000000000000000000000000", buffer);
+}
+
+CTEST(uint512, to_string_max_octal) {
+    char buffer[200];
+    char expected[200];
+
+    expected[0] = '3';
+    memset(expected + 1, '7', 170);
+    expected[171] = '\0';
+
+    ASSERT_EQUAL(INT512_OK, uint512_to_string(&UINT512_MAX, buffer, sizeof(buffer), 8));
+    ASSERT_STR(expected, buffer);
+}
+
+CTEST(uint512, to_string_buffer_too_small) {
+    uint512_t value = {{12345, 0, 0, 0, 0, 0, 0, 0}};
+    char buffer[5];
+
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_to_string(&value, buffer, sizeof(buffer), 10));
+    ASSERT_EQUAL(INT512_OK, uint512_to_string(&value, buffer, 6, 10));
+}
+
+CTEST(uint512, digits_needed_bounds_format) {
+    /* Check 2^k - 1 and 2^k, the extremes for each bit length */
+    for (int base = 2; base <= 36; base++) {
+        uint512_t value = UINT512_ZERO;
+        for (int k = 0; k < 512; k++) {
+            uint512_t power = UINT512_ZERO;
+            power.words[k / 64] = (uint64_t)1 << (k % 64);
+
+            size_t exact = uint512_format(&value, NULL, 0, base);
+            size_t needed = uint512_digits_needed(&value, base);
+            ASSERT_TRUE(needed >= exact && needed <= exact + 1);
+
+            exact = uint512_format(&power, NULL, 0, base);
+            needed = uint512_digits_needed(&power, base);
+            ASSERT_TRUE(needed >= exact && needed <= exact + 1);
+
+            uint512_add(&value, &power, &value);
+        }
+    }
+}
+
+CTEST(uint512, format_back_to_back) {
+    uint512_t a = {{12345, 0, 0, 0, 0, 0, 0, 0}};
+    uint512_t b = {{0, 0, 0, 0, 0, 0, 0, 0}};
+    char buffer[16];
+    size_t pos = 0;
+
+    memset(buffer, '#', sizeof(buffer));
+    pos += uint512_format(&a, buffer + pos, sizeof(buffer) - pos, 10);
+    buffer[pos++] = ',';
+    pos += uint512_format(&b, buffer + pos, sizeof(buffer) - pos, 10);
+    buffer[pos] = '\0';
+
+    ASSERT_STR("12345,0", buffer);
+}
+
+CTEST(uint512, format_too_small_writes_nothing) {
+    uint512_t value = {{12345, 0, 0, 0, 0, 0, 0, 0}};
+    char buffer[8] = "#######";
+
+    ASSERT_EQUAL(5, (int)uint512_format(&value, buffer, 4, 10));
+    ASSERT_STR("#######", buffer);
+    ASSERT_EQUAL(0, (int)uint512_format(&value, buffer, sizeof(buffer), 37));
+}
+
 CTEST(uint512, from_string_decimal) {
     uint512_t result;
 
@@ -292,6 +1726,54 @@ CTEST(uint512, from_string_binary) {
     ASSERT_EQUAL(5ULL, result.words[0]);
 }
 
+CTEST(uint512, from_string_max_decimal) {
+    uint512_t result;
+
+    ASSERT_EQUAL(INT512_OK, uint512_from_string("13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084095", &result, 10));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_MAX, &result));
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_from_string("13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084096", &result, 10));
+}
+
+CTEST(uint512, from_string_overflow_before_invalid) {
+    char str[210];
+    uint512_t result;
+
+    memset(str, '9', 200);
+    str[200] = 'G';
+    str[201] = '\0';
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_from_string(str, &result, 10));
+
+    memset(str, '0', 200);
+    str[200] = '7';
+    str[201] = '\0';
+    ASSERT_EQUAL(INT512_OK, uint512_from_string(str, &result, 10));
+    ASSERT_EQUAL(7ULL, result.words[0]);
+}
+
+CTEST(uint512, from_string_power_of_two_overflow) {
+    char str[200];
+    uint512_t result;
+
+    memset(str, 'f', 128);
+    str[128] = '\0';
+    ASSERT_EQUAL(INT512_OK, uint512_from_string(str, &result, 16));
+    ASSERT_EQUAL(0, uint512_compare(&UINT512_MAX, &result));
+
+    str[0] = '1';
+    memset(str + 1, '0', 128);
+    str[129] = '\0';
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_from_string(str, &result, 16));
+
+    str[0] = '4';
+    memset(str + 1, '0', 170);
+    str[171] = '\0';
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_from_string(str, &result, 8));
+
+    str[0] = '2';
+    ASSERT_EQUAL(INT512_OK, uint512_from_string(str, &result, 8));
+    ASSERT_EQUAL((uint64_t)1 << 63, result.words[7]);
+}
+
 CTEST(uint512, from_string_invalid) {
     uint512_t result;
 
@@ -305,6 +1787,112 @@ CTEST(uint512, from_string_invalid_base) {
     ASSERT_EQUAL(INT512_ERR_INVALID_BASE, uint512_from_string("123", &result, 37));
 }
 
+CTEST(uint512, from_chars_stops_at_delimiter) {
+    const char *csv = "123,456";
+    uint512_t result;
+    size_t consumed;
+
+    ASSERT_EQUAL(INT512_OK, uint512_from_chars(csv, strlen(csv), &consumed, &result, 10));
+    ASSERT_EQUAL(123ULL, result.words[0]);
+    ASSERT_EQUAL(3, (int)consumed);
+
+    ASSERT_EQUAL(INT512_OK, uint512_from_chars(csv + 4, 3, &consumed, &result, 10));
+    ASSERT_EQUAL(456ULL, result.words[0]);
+    ASSERT_EQUAL(3, (int)consumed);
+}
+
+CTEST(uint512, from_chars_respects_length) {
+    uint512_t result;
+    size_t consumed;
+
+    ASSERT_EQUAL(INT512_OK, uint512_from_chars(" +12345", 4, &consumed, &result, 10));
+    ASSERT_EQUAL(12ULL, result.words[0]);
+    ASSERT_EQUAL(4, (int)consumed);
+}
+
+CTEST(uint512, from_chars_no_digits) {
+    uint512_t result;
+    size_t consumed = 99;
+
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_from_chars(",1", 2, &consumed, &result, 10));
+    ASSERT_EQUAL(0, (int)consumed);
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_from_chars("1", 0, &consumed, &result, 10));
+}
+
+CTEST(uint512, from_chars_overflow_reports_extent) {
+    char buffer[210];
+    uint512_t result;
+    size_t consumed;
+
+    memset(buffer, '9', 200);
+    buffer[200] = ',';
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_from_chars(buffer, 201, &consumed, &result, 10));
+    ASSERT_EQUAL(200, (int)consumed);
+}
+
+CTEST(uint512, to_hex_fixed_width) {
+    uint512_t value = {{0x0123456789abcdefULL, 0, 0, 0, 0, 0, 0, 0xfedcba9876543210ULL}};
+    char buffer[129];
+
+    ASSERT_EQUAL(INT512_OK, uint512_to_hex(&value, buffer, sizeof(buffer), 0));
+    ASSERT_EQUAL(128, (int)strlen(buffer));
+    ASSERT_STR("fedcba9876543210000000000000000000000000000000000000000000000000"
+               "0000000000000000000000000000000000000000000000000123456789abcdef", buffer);
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_to_hex(&value, buffer, 128, 0));
+}
+
+CTEST(uint512, to_hex_flags) {
+    uint512_t value = {{0xabcdefULL, 0, 0, 0, 0, 0, 0, 0}};
+    char buffer[129];
+
+    ASSERT_EQUAL(INT512_OK, uint512_to_hex(&value, buffer, 7, UINT512_HEX_TRIM | UINT512_HEX_UPPERCASE));
+    ASSERT_STR("ABCDEF", buffer);
+    ASSERT_EQUAL(INT512_OK, uint512_to_hex(&UINT512_ZERO, buffer, 2, UINT512_HEX_TRIM));
+    ASSERT_STR("0", buffer);
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_to_hex(&value, buffer, 6, UINT512_HEX_TRIM));
+}
+
+CTEST(uint512, from_hex_roundtrip) {
+    uint512_t value, result;
+    char buffer[129];
+
+    rng_seed(0x9e3779b97f4a7c15ULL);
+    rng_fill(&value, 8);
+    ASSERT_EQUAL(INT512_OK, uint512_to_hex(&value, buffer, sizeof(buffer), UINT512_HEX_UPPERCASE));
+    ASSERT_EQUAL(INT512_OK, uint512_from_hex(buffer, 128, &result));
+    ASSERT_EQUAL(0, uint512_compare(&value, &result));
+
+    ASSERT_EQUAL(INT512_OK, uint512_from_hex("aBc", 3, &result));
+    ASSERT_EQUAL(0xabcULL, result.words[0]);
+}
+
+CTEST(uint512, from_hex_rejects_each_position) {
+    char buffer[129];
+    uint512_t result;
+
+    memset(buffer, '7', 128);
+    for (int i = 0; i < 128; i++) {
+        buffer[i] = (i % 2) ? 'g' : '/';
+        ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_from_hex(buffer, 128, &result));
+        buffer[i] = '7';
+    }
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_from_hex("0x1", 3, &result));
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_from_hex("1", 0, &result));
+}
+
+CTEST(uint512, from_hex_overflow) {
+    char buffer[140];
+    uint512_t result;
+
+    memset(buffer, '0', 132);
+    buffer[131] = '1';
+    ASSERT_EQUAL(INT512_OK, uint512_from_hex(buffer, 132, &result));
+    ASSERT_EQUAL(1ULL, result.words[0]);
+
+    buffer[3] = '1';
+    ASSERT_EQUAL(INT512_ERR_OVERFLOW, uint512_from_hex(buffer, 132, &result));
+}
+
 CTEST(int512, to_string_positive) {
     int512_t value = {{12345, 0, 0, 0, 0, 0, 0, 0}};
     char buffer[200];
@@ -325,6 +1913,19 @@ CTEST(int512, to_string_negative) {
     ASSERT_STR("-12345", buffer);
 }
 
+CTEST(int512, format_negative) {
+    int512_t value;
+    value.words[0] = (uint64_t)-255;
+    for (int i = 1; i < 8; i++) value.words[i] = UINT64_MAX;
+    char buffer[8];
+
+    ASSERT_EQUAL(3, (int)int512_digits_needed(&value, 16));
+    ASSERT_EQUAL(3, (int)int512_format(&value, buffer, sizeof(buffer), 16));
+    buffer[3] = '\0';
+    ASSERT_STR("-ff", buffer);
+    ASSERT_EQUAL(3, (int)int512_format(&value, buffer, 2, 16));
+}
+
 CTEST(int512, from_string_positive) {
     int512_t result;
 
@@ -339,6 +1940,88 @@ CTEST(int512, from_string_negative) {
     ASSERT_TRUE(int512_is_negative(&result));
 }
 
+CTEST(int512, from_chars_negative) {
+    const char *json = "-42}";
+    int512_t result;
+    size_t consumed;
+
+    ASSERT_EQUAL(INT512_OK, int512_from_chars(json, strlen(json), &consumed, &result, 10));
+    ASSERT_TRUE(int512_is_negative(&result));
+    ASSERT_EQUAL((uint64_t)-42, result.words[0]);
+    ASSERT_EQUAL(3, (int)consumed);
+}
+
+/* ============================================================================
+ * Batch String Conversion Tests
+ * ============================================================================ */
+
+CTEST(batch, uint512_roundtrip) {
+    uint512_t values[4] = {
+        {{0, 0, 0, 0, 0, 0, 0, 0}},
+        {{12345, 0, 0, 0, 0, 0, 0, 0}},
+        {{UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX,
+          UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}},
+        {{0, 1, 0, 0, 0, 0, 0, 0}},
+    };
+    char buffer[400];
+    size_t offsets[5];
+    uint512_t parsed[4];
+    int512_error_t errors[4];
+
+    ASSERT_EQUAL(INT512_OK, uint512_to_string_batch(values, 4, buffer, sizeof(buffer), offsets, 10));
+    ASSERT_EQUAL(0, (int)offsets[0]);
+    ASSERT_EQUAL(1, (int)offsets[1]);
+    ASSERT_EQUAL(6, (int)offsets[2]);
+    ASSERT_DATA((const unsigned char *)"012345", 6, (const unsigned char *)buffer, 6);
+
+    ASSERT_EQUAL(INT512_OK, uint512_from_string_batch(buffer, offsets, 4, parsed, errors, 10));
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQUAL(INT512_OK, errors[i]);
+        ASSERT_EQUAL(0, uint512_compare(&values[i], &parsed[i]));
+    }
+}
+
+CTEST(batch, int512_roundtrip) {
+    int512_t values[3] = {
+        {{5, 0, 0, 0, 0, 0, 0, 0}},
+        {{(uint64_t)-7, UINT64_MAX, UINT64_MAX, UINT64_MAX,
+          UINT64_MAX, UINT64_MAX, UINT64_MAX, UINT64_MAX}},
+        {{0, 0, 0, 0, 0, 0, 0, (uint64_t)INT64_MIN}},
+    };
+    char buffer[400];
+    size_t offsets[4];
+    int512_t parsed[3];
+
+    ASSERT_EQUAL(INT512_OK, int512_to_string_batch(values, 3, buffer, sizeof(buffer), offsets, 16));
+    ASSERT_DATA((const unsigned char *)"5-7-8", 5, (const unsigned char *)buffer, 5);
+
+    ASSERT_EQUAL(INT512_OK, int512_from_string_batch(buffer, offsets, 3, parsed, NULL, 16));
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQUAL(0, int512_compare(&values[i], &parsed[i]));
+    }
+}
+
+CTEST(batch, buffer_too_small) {
+    uint512_t values[2] = {{{123, 0, 0, 0, 0, 0, 0, 0}}, {{456, 0, 0, 0, 0, 0, 0, 0}}};
+    char buffer[5];
+    size_t offsets[3];
+
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_to_string_batch(values, 2, buffer, sizeof(buffer), offsets, 10));
+}
+
+CTEST(batch, parse_reports_each_field) {
+    const char *buffer = "1x23";
+    size_t offsets[4] = {0, 1, 2, 4};
+    uint512_t parsed[3];
+    int512_error_t errors[3];
+
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, uint512_from_string_batch(buffer, offsets, 3, parsed, errors, 10));
+    ASSERT_EQUAL(INT512_OK, errors[0]);
+    ASSERT_EQUAL(INT512_ERR_INVALID_STRING, errors[1]);
+    ASSERT_EQUAL(INT512_OK, errors[2]);
+    ASSERT_EQUAL(23ULL, parsed[2].words[0]);
+}
+
 /* ============================================================================
  * Utility Function Tests
  * ============================================================================ */
@@ -480,6 +2163,19 @@ CTEST(roundtrip, int512_negative) {
     ASSERT_EQUAL(0, int512_compare(&original, &parsed));
 }
 
+CTEST(roundtrip, uint512_all_bases) {
+    char buffer[600];
+    uint512_t original = {{0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x1111111111111111ULL,
+                           0x8000000000000001ULL, 42, 0, UINT64_MAX, 0x7fffffffffffffffULL}};
+
+    for (int base = 2; base <= 36; base++) {
+        uint512_t parsed;
+        ASSERT_EQUAL(INT512_OK, uint512_to_string(&original, buffer, sizeof(buffer), base));
+        ASSERT_EQUAL(INT512_OK, uint512_from_string(buffer, &parsed, base));
+        ASSERT_EQUAL(0, uint512_compare(&original, &parsed));
+    }
+}
+
 CTEST(roundtrip, uint512_base36) {
     char buffer[200];
     uint512_t original = {{1234567890ULL, 0, 0, 0, 0, 0, 0, 0}};